@@ -214,6 +214,30 @@ bool DynamicMapTree::isInLineOfSight(float x1, float y1, float z1, float x2, flo
     return !callback.did_hit;
 }
 
+void DynamicMapTree::isInLineOfSight(G3D::Vector3 const* sources, bool* results, uint32 count, float x2, float y2, float z2, uint32 phasemask) const
+{
+    // nothing can block when no gameobject model is spawned on the map
+    if (!impl->size())
+        return;
+
+    G3D::Vector3 v2(x2, y2, z2);
+    for (uint32 i = 0; i < count; ++i)
+    {
+        if (!results[i])
+            continue;
+
+        G3D::Vector3 const& v1 = sources[i];
+        float maxDist = (v2 - v1).magnitude();
+        if (!G3D::fuzzyGt(maxDist, 0))
+            continue;
+
+        G3D::Ray r(v1, (v2 - v1) / maxDist);
+        DynamicTreeIntersectionCallback callback(phasemask);
+        impl->intersectRay(r, callback, maxDist, v2, true);
+        results[i] = !callback.did_hit;
+    }
+}
+
 float DynamicMapTree::getHeight(float x, float y, float z, float maxSearchDist, uint32 phasemask) const
 {
     G3D::Vector3 v(x, y, z + 2.0f);
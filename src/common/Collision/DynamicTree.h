@@ -30,6 +30,10 @@ public:
     bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2,
                          float z2, uint32 phasemask) const;
 
+    // tests only the sources whose result is still true
+    void isInLineOfSight(G3D::Vector3 const* sources, bool* results, uint32 count,
+                         float x2, float y2, float z2, uint32 phasemask) const;
+
     bool getIntersectionTime(uint32 phasemask, const G3D::Ray& ray,
                              const G3D::Vector3& endPos, float& maxDist) const;
 
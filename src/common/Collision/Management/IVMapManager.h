@@ -10,6 +10,11 @@
 #include <string>
 #include "Define.h"
 
+namespace G3D
+{
+    class Vector3;
+}
+
 //===========================================================
 
 /**
@@ -49,6 +54,10 @@ namespace VMAP
             virtual void unloadMap(unsigned int pMapId) = 0;
 
             virtual bool isInLineOfSight(unsigned int pMapId, float x1, float y1, float z1, float x2, float y2, float z2) = 0;
+            /**
+            test line of sight from count sources to one position, results[i] is only tested (and possibly cleared) while it is still true
+            */
+            virtual void isInLineOfSight(unsigned int pMapId, G3D::Vector3 const* sources, bool* results, unsigned int count, float x2, float y2, float z2) = 0;
             virtual float getHeight(unsigned int pMapId, float x, float y, float z, float maxSearchDist) = 0;
             /**
             test if we hit an object. return true if we hit one. rx, ry, rz will hold the hit position or the dest position, if no intersection was found
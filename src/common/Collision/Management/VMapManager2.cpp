@@ -155,6 +155,30 @@ namespace VMAP
         return true;
     }
 
+    void VMapManager2::isInLineOfSight(unsigned int mapId, G3D::Vector3 const* sources, bool* results, unsigned int count, float x2, float y2, float z2)
+    {
+#if defined(ENABLE_EXTRAS) && defined(ENABLE_VMAP_CHECKS)
+        if (!isLineOfSightCalcEnabled() || DisableMgr::IsDisabledFor(DISABLE_TYPE_VMAP, mapId, NULL, VMAP_DISABLE_LOS))
+            return;
+#endif
+
+        // map lookup and end point conversion are shared by the whole batch
+        InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+            return;
+
+        Vector3 pos2 = convertPositionToInternalRep(x2, y2, z2);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            if (!results[i])
+                continue;
+
+            Vector3 pos1 = convertPositionToInternalRep(sources[i].x, sources[i].y, sources[i].z);
+            if (pos1 != pos2)
+                results[i] = instanceTree->second->isInLineOfSight(pos1, pos2);
+        }
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
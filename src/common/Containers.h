@@ -8,7 +8,9 @@
 #define TRINITY_CONTAINERS_H
 
 #include "Define.h"
+#include <algorithm>
 #include <list>
+#include <vector>
 
 //! Because circular includes are bad
 extern uint32 urand(uint32 min, uint32 max);
@@ -21,13 +23,20 @@ namespace Trinity
         void RandomResizeList(std::list<T> &list, uint32 size)
         {
             size_t list_size = list.size();
+            if (list_size <= size)
+                return;
 
-            while (list_size > size)
+            // selection sampling: one pass, keeps every subset of `size` elements equally likely and preserves order
+            size_t needed = size;
+            for (typename std::list<T>::iterator itr = list.begin(); itr != list.end() && list_size > needed; --list_size)
             {
-                typename std::list<T>::iterator itr = list.begin();
-                std::advance(itr, urand(0, list_size - 1));
-                list.erase(itr);
-                --list_size;
+                if (needed && urand(0, list_size - 1) < needed)
+                {
+                    --needed;
+                    ++itr;
+                }
+                else
+                    itr = list.erase(itr);
             }
         }
 
@@ -35,15 +44,16 @@ namespace Trinity
         void RandomResizeList(std::list<T> &list, Predicate& predicate, uint32 size)
         {
             //! First use predicate filter
-            std::list<T> listCopy;
-            for (typename std::list<T>::iterator itr = list.begin(); itr != list.end(); ++itr)
+            for (typename std::list<T>::iterator itr = list.begin(); itr != list.end();)
+            {
                 if (predicate(*itr))
-                    listCopy.push_back(*itr);
+                    ++itr;
+                else
+                    itr = list.erase(itr);
+            }
 
             if (size)
-                RandomResizeList(listCopy, size);
-
-            list = listCopy;
+                RandomResizeList(list, size);
         }
 
         /* Select a random element from a container. Note: make sure you explicitly empty check the container */
@@ -53,6 +63,60 @@ namespace Trinity
             std::advance(it, urand(0, container.size() - 1));
             return *it;
         }
+
+        /* Sorted vector with a std::set like interface, for small sets that are iterated far more often than modified */
+        template <class T>
+        class FlatSet
+        {
+            public:
+                typedef T value_type;
+                typedef typename std::vector<T>::const_iterator const_iterator;
+                typedef const_iterator iterator;
+
+                std::pair<iterator, bool> insert(T const& value)
+                {
+                    // values usually arrive in ascending order, appending is the common case
+                    if (_values.empty() || _values.back() < value)
+                    {
+                        _values.push_back(value);
+                        return std::make_pair(_values.end() - 1, true);
+                    }
+
+                    typename std::vector<T>::iterator itr = std::lower_bound(_values.begin(), _values.end(), value);
+                    if (*itr == value)
+                        return std::make_pair(iterator(itr), false);
+
+                    return std::make_pair(iterator(_values.insert(itr, value)), true);
+                }
+
+                size_t erase(T const& value)
+                {
+                    typename std::vector<T>::iterator itr = std::lower_bound(_values.begin(), _values.end(), value);
+                    if (itr == _values.end() || *itr != value)
+                        return 0;
+
+                    _values.erase(itr);
+                    return 1;
+                }
+
+                const_iterator find(T const& value) const
+                {
+                    const_iterator itr = std::lower_bound(_values.begin(), _values.end(), value);
+                    return itr != _values.end() && *itr == value ? itr : _values.end();
+                }
+
+                size_t count(T const& value) const { return find(value) != _values.end() ? 1 : 0; }
+
+                const_iterator begin() const { return _values.begin(); }
+                const_iterator end() const { return _values.end(); }
+                size_t size() const { return _values.size(); }
+                bool empty() const { return _values.empty(); }
+                void clear() { _values.clear(); }
+                void shrink_to_fit() { _values.shrink_to_fit(); }
+
+            private:
+                std::vector<T> _values;
+        };
     }
     //! namespace Containers
 }
@@ -22,6 +22,18 @@ bool DBCFileLoader::Load(const char* filename, const char* fmt)
         data = NULL;
     }
 
+    if (stringTable)
+    {
+        delete [] stringTable;
+        stringTable = NULL;
+    }
+
+    if (fieldsOffset)
+    {
+        delete [] fieldsOffset;
+        fieldsOffset = NULL;
+    }
+
     FILE* f = fopen(filename, "rb");
     if (!f)
         return false;
@@ -84,10 +96,13 @@ bool DBCFileLoader::Load(const char* filename, const char* fmt)
             fieldsOffset[i] += sizeof(uint32);
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
-    stringTable = data + recordSize*recordCount;
+    // records and strings get separate blocks, the string block is handed over
+    // as the storage string pool by AutoProduceStrings instead of being copied
+    data = new unsigned char[recordSize * recordCount];
+    stringTable = new unsigned char[stringSize];
 
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
+    if ((recordSize * recordCount && fread(data, recordSize * recordCount, 1, f) != 1) ||
+        (stringSize && fread(stringTable, stringSize, 1, f) != 1))
     {
         fclose(f);
         return false;
@@ -103,6 +118,9 @@ DBCFileLoader::~DBCFileLoader()
     if (data)
         delete [] data;
 
+    if (stringTable)
+        delete [] stringTable;
+
     if (fieldsOffset)
         delete [] fieldsOffset;
 }
@@ -211,8 +229,9 @@ char* DBCFileLoader::AutoProduceData(const char* format, uint32& records, char**
 
     for (uint32 y = 0; y < recordCount; ++y)
     {
+        Record record = getRecord(y);
         if (i >= 0)
-            indexTable[getRecord(y).getUInt(i)] = &dataTable[offset];
+            indexTable[record.getUInt(i)] = &dataTable[offset];
         else
             indexTable[y] = &dataTable[offset];
 
@@ -221,16 +240,16 @@ char* DBCFileLoader::AutoProduceData(const char* format, uint32& records, char**
             switch (format[x])
             {
                 case FT_FLOAT:
-                    *((float*)(&dataTable[offset])) = getRecord(y).getFloat(x);
+                    *((float*)(&dataTable[offset])) = record.getFloat(x);
                     offset += sizeof(float);
                     break;
                 case FT_IND:
                 case FT_INT:
-                    *((uint32*)(&dataTable[offset])) = getRecord(y).getUInt(x);
+                    *((uint32*)(&dataTable[offset])) = record.getUInt(x);
                     offset += sizeof(uint32);
                     break;
                 case FT_BYTE:
-                    *((uint8*)(&dataTable[offset])) = getRecord(y).getUInt8(x);
+                    *((uint8*)(&dataTable[offset])) = record.getUInt8(x);
                     offset += sizeof(uint8);
                     break;
                 case FT_STRING:
@@ -261,13 +280,14 @@ char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
     if (strlen(format) != fieldCount)
         return NULL;
 
-    char* stringPool = new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
+    // the string block read from the file becomes the pool as is
+    char* stringPool = reinterpret_cast<char*>(stringTable);
 
     uint32 offset = 0;
 
     for (uint32 y = 0; y < recordCount; ++y)
     {
+        Record record = getRecord(y);
         for (uint32 x = 0; x < fieldCount; ++x)
         {
             switch (format[x])
@@ -287,10 +307,7 @@ char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
                     // fill only not filled entries
                     char** slot = (char**)(&dataTable[offset]);
                     if (!*slot || !**slot)
-                    {
-                        const char * st = getRecord(y).getString(x);
-                        *slot=stringPool+(st-(const char*)stringTable);
-                    }
+                        *slot = const_cast<char*>(record.getString(x));
                     offset += sizeof(char*);
                     break;
                  }
@@ -308,5 +325,7 @@ char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
         }
     }
 
+    // ownership of the pool passes to the caller
+    stringTable = NULL;
     return stringPool;
 }
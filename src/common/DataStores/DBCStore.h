@@ -14,6 +14,7 @@
 #include "Implementation/WorldDatabase.h"
 #include "DatabaseEnv.h"
 #include <unordered_map>
+#include <vector>
 
 struct SqlDbc
 {
@@ -57,7 +58,7 @@ struct SqlDbc
 template<class T>
 class DBCStorage
 {
-    typedef std::list<char*> StringPoolList;
+    typedef std::vector<char*> StringPoolList;
     public:
         explicit DBCStorage(char const* f)
 #ifndef ELUNA
@@ -288,11 +289,9 @@ class DBCStorage
             delete[] reinterpret_cast<char*>(dataTable);
             dataTable = NULL;
 
-            while (!stringPoolList.empty())
-            {
-                delete[] stringPoolList.front();
-                stringPoolList.pop_front();
-            }
+            for (typename StringPoolList::const_iterator itr = stringPoolList.begin(); itr != stringPoolList.end(); ++itr)
+                delete[] *itr;
+            stringPoolList.clear();
 
             nCount = 0;
         }
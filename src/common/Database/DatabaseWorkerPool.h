@@ -22,6 +22,7 @@
 
 #define MIN_MYSQL_SERVER_VERSION 50100u
 #define MIN_MYSQL_CLIENT_VERSION 50100u
+#define MIN_QUERY_HOLDER_CHUNK_SIZE 8
 
 class PingOperation : public SQLOperation
 {
@@ -331,9 +332,27 @@ class DatabaseWorkerPool
         QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder)
         {
             QueryResultHolderFuture res;
-            SQLQueryHolderTask* task = new SQLQueryHolderTask(holder, res);
-            Enqueue(task);
-            return res;     //! Fool compiler, has no use yet
+
+            //! Large holders (e.g. player login) are split into chunks executed by several async
+            //! connections in parallel instead of running every query back to back on one of them.
+            size_t size = holder->GetSize();
+            size_t chunks = std::min<size_t>(_connectionCount[IDX_ASYNC], size / MIN_QUERY_HOLDER_CHUNK_SIZE);
+            if (chunks <= 1)
+            {
+                Enqueue(new SQLQueryHolderTask(holder, res));
+                return res;     //! Fool compiler, has no use yet
+            }
+
+            std::atomic<uint32>* pending = new std::atomic<uint32>(uint32(chunks));
+            size_t begin = 0;
+            for (size_t i = 0; i < chunks; ++i)
+            {
+                size_t end = begin + (size - begin) / (chunks - i);
+                Enqueue(new SQLQueryHolderTask(holder, res, begin, end, pending));
+                begin = end;
+            }
+
+            return res;
         }
 
         /**
@@ -488,7 +488,6 @@ enum CharacterDatabaseStatements
     CHAR_INS_ITEMCONTAINER_SINGLE_ITEM,
     CHAR_DEL_ITEMCONTAINER_CONTAINER,
 
-    CHAR_SEL_PVPSTATS_MAXID,
     CHAR_INS_PVPSTATS_BATTLEGROUND,
     CHAR_INS_PVPSTATS_PLAYER,
     CHAR_SEL_PVPSTATS_FACTIONS_OVERALL,
@@ -167,7 +167,7 @@ bool SQLQueryHolderTask::Execute()
     /// we can do this, we are friends
     std::vector<SQLQueryHolder::SQLResultPair> &queries = m_holder->m_queries;
 
-    for (size_t i = 0; i < queries.size(); i++)
+    for (size_t i = m_begin; i < m_end && i < queries.size(); i++)
     {
         /// execute all queries in the holder and pass the results
         if (SQLElementData* data = &queries[i].first)
@@ -192,6 +192,15 @@ bool SQLQueryHolderTask::Execute()
         }
     }
 
+    // other parts of a split holder are still running
+    if (m_pending)
+    {
+        if (--(*m_pending))
+            return true;
+
+        delete m_pending;
+    }
+
     m_result.set(m_holder);
     return true;
 }
@@ -8,6 +8,7 @@
 #define _QUERYHOLDER_H
 
 #include <ace/Future.h>
+#include <atomic>
 
 class SQLQueryHolder
 {
@@ -26,19 +27,27 @@ class SQLQueryHolder
         PreparedQueryResult GetPreparedResult(size_t index);
         void SetResult(size_t index, ResultSet* result);
         void SetPreparedResult(size_t index, PreparedResultSet* result);
+        size_t GetSize() const { return m_queries.size(); }
 };
 
 typedef ACE_Future<SQLQueryHolder*> QueryResultHolderFuture;
 
+/// Executes the queries [begin, end) of a holder. A holder split across several tasks shares one
+/// pending counter, the task finishing last publishes the holder through the future.
 class SQLQueryHolderTask : public SQLOperation
 {
     private:
         SQLQueryHolder * m_holder;
         QueryResultHolderFuture m_result;
+        size_t m_begin;
+        size_t m_end;
+        std::atomic<uint32>* m_pending;
 
     public:
         SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res)
-            : m_holder(holder), m_result(res){ };
+            : m_holder(holder), m_result(res), m_begin(0), m_end(holder ? holder->GetSize() : 0), m_pending(NULL) { };
+        SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res, size_t begin, size_t end, std::atomic<uint32>* pending)
+            : m_holder(holder), m_result(res), m_begin(begin), m_end(end), m_pending(pending) { };
         bool Execute();
 
 };
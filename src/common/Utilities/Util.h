@@ -11,6 +11,7 @@
 #include "Errors.h"
 
 #include <algorithm>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <list>
@@ -547,12 +548,48 @@ bool CompareValues(ComparisionType type, T val1, T val2)
     }
 }
 
+// Number of events an EventMap stores without heap allocation
+#ifndef EVENT_MAP_INLINE_EVENTS
+#define EVENT_MAP_INLINE_EVENTS 16
+#endif
+
+/// Events are kept in a small array sorted by time; events with the same time keep
+/// their scheduling order, like the multimap this replaced. The array lives inside the
+/// map and only moves to the heap when more than EVENT_MAP_INLINE_EVENTS are scheduled.
 class EventMap
 {
-    typedef std::multimap<uint32, uint32> EventStore;
+    struct Event
+    {
+        uint32 Time;
+        uint32 Id;
+    };
 
     public:
-        EventMap() : _time(0), _phase(0) { }
+        EventMap() : _time(0), _phase(0), _events(_inline), _size(0), _capacity(EVENT_MAP_INLINE_EVENTS) { }
+
+        EventMap(EventMap const& right) : _time(0), _phase(0), _events(_inline), _size(0), _capacity(EVENT_MAP_INLINE_EVENTS)
+        {
+            *this = right;
+        }
+
+        ~EventMap()
+        {
+            if (_events != _inline)
+                delete[] _events;
+        }
+
+        EventMap& operator=(EventMap const& right)
+        {
+            if (this != &right)
+            {
+                Reserve(right._size);
+                memcpy(_events, right._events, right._size * sizeof(Event));
+                _size = right._size;
+                _time = right._time;
+                _phase = right._phase;
+            }
+            return *this;
+        }
 
         /**
         * @name Reset
@@ -560,7 +597,7 @@ class EventMap
         */
         void Reset()
         {
-            _eventMap.clear();
+            _size = 0;
             _time = 0;
             _phase = 0;
         }
@@ -604,7 +641,7 @@ class EventMap
         */
         bool Empty() const
         {
-            return _eventMap.empty();
+            return _size == 0;
         }
 
         /**
@@ -658,7 +695,7 @@ class EventMap
             if (phase && phase <= 8)
                 eventId |= (1 << (phase + 23));
 
-            _eventMap.insert(EventStore::value_type(_time + time, eventId));
+            Insert(_time + time, eventId);
         }
 
         /**
@@ -688,8 +725,8 @@ class EventMap
             if (Empty())
                 return;
 
-            uint32 eventId = _eventMap.begin()->second;
-            _eventMap.erase(_eventMap.begin());
+            uint32 eventId = _events[0].Id;
+            Erase(0);
             ScheduleEvent(eventId, time);
         }
 
@@ -700,7 +737,7 @@ class EventMap
         void PopEvent()
         {
             if (!Empty())
-                _eventMap.erase(_eventMap.begin());
+                Erase(0);
         }
 
         /**
@@ -712,16 +749,16 @@ class EventMap
         {
             while (!Empty())
             {
-                EventStore::iterator itr = _eventMap.begin();
+                Event const& event = _events[0];
 
-                if (itr->first > _time)
+                if (event.Time > _time)
                     return 0;
-                else if (_phase && (itr->second & 0xFF000000) && !((itr->second >> 24) & _phase))
-                    _eventMap.erase(itr);
+                else if (_phase && (event.Id & 0xFF000000) && !((event.Id >> 24) & _phase))
+                    Erase(0);
                 else
                 {
-                    uint32 eventId = (itr->second & 0x0000FFFF);
-                    _eventMap.erase(itr);
+                    uint32 eventId = (event.Id & 0x0000FFFF);
+                    Erase(0);
                     return eventId;
                 }
             }
@@ -738,14 +775,14 @@ class EventMap
         {
             while (!Empty())
             {
-                EventStore::iterator itr = _eventMap.begin();
+                Event const& event = _events[0];
 
-                if (itr->first > _time)
+                if (event.Time > _time)
                     return 0;
-                else if (_phase && (itr->second & 0xFF000000) && !(itr->second & (_phase << 24)))
-                    _eventMap.erase(itr);
+                else if (_phase && (event.Id & 0xFF000000) && !(event.Id & (_phase << 24)))
+                    Erase(0);
                 else
-                    return (itr->second & 0x0000FFFF);
+                    return (event.Id & 0x0000FFFF);
             }
 
             return 0;
@@ -763,16 +800,17 @@ class EventMap
 
         void DelayEventsToMax(uint32 delay, uint32 group)
         {
-            for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
+            for (uint32 i = 0; i < _size;)
             {
-                if (itr->first < _time+delay && (group == 0 || ((1 << (group + 15)) & itr->second)))
+                if (_events[i].Time < _time+delay && (group == 0 || ((1 << (group + 15)) & _events[i].Id)))
                 {
-                    ScheduleEvent(itr->second, delay);
-                    _eventMap.erase(itr);
-                    itr = _eventMap.begin();
+                    uint32 eventId = _events[i].Id;
+                    Erase(i);
+                    ScheduleEvent(eventId, delay);
+                    i = 0;
                 }
                 else
-                    ++itr;
+                    ++i;
             }
         }
 
@@ -787,20 +825,30 @@ class EventMap
             if (group > 8 || Empty())
                 return;
 
-            EventStore delayed;
-
-            for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
+            // move the delayed events to the end, keeping their order
+            uint32 kept = 0;
+            for (uint32 i = 0, delayed = 0; i + delayed < _size;)
             {
-                if (!group || (itr->second & (1 << (group + 15))))
+                if (!group || (_events[i].Id & (1 << (group + 15))))
                 {
-                    delayed.insert(EventStore::value_type(itr->first + delay, itr->second));
-                    _eventMap.erase(itr++);
+                    Event event = _events[i];
+                    event.Time += delay;
+                    memmove(&_events[i], &_events[i + 1], (_size - i - 1) * sizeof(Event));
+                    _events[_size - 1] = event;
+                    ++delayed;
                 }
                 else
-                    ++itr;
+                    ++i, ++kept;
             }
 
-            _eventMap.insert(delayed.begin(), delayed.end());
+            // then insert them one by one behind all events with the same time
+            for (uint32 i = kept; i < _size; ++i)
+            {
+                Event event = _events[i];
+                uint32 pos = UpperBound(event.Time, i);
+                memmove(&_events[pos + 1], &_events[pos], (i - pos) * sizeof(Event));
+                _events[pos] = event;
+            }
         }
 
         /**
@@ -810,16 +858,12 @@ class EventMap
         */
         void CancelEvent(uint32 eventId)
         {
-            if (Empty())
-                return;
+            uint32 kept = 0;
+            for (uint32 i = 0; i < _size; ++i)
+                if (eventId != (_events[i].Id & 0x0000FFFF))
+                    _events[kept++] = _events[i];
 
-            for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
-            {
-                if (eventId == (itr->second & 0x0000FFFF))
-                    _eventMap.erase(itr++);
-                else
-                    ++itr;
-            }
+            _size = kept;
         }
 
         /**
@@ -833,16 +877,12 @@ class EventMap
                 return;
 
             uint32 groupMask = (1 << (group + 15));
-            for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
-            {
-                if (itr->second & groupMask)
-                {
-                    _eventMap.erase(itr);
-                    itr = _eventMap.begin();
-                }
-                else
-                    ++itr;
-            }
+            uint32 kept = 0;
+            for (uint32 i = 0; i < _size; ++i)
+                if (!(_events[i].Id & groupMask))
+                    _events[kept++] = _events[i];
+
+            _size = kept;
         }
 
         /**
@@ -853,12 +893,9 @@ class EventMap
         */
         uint32 GetNextEventTime(uint32 eventId) const
         {
-            if (Empty())
-                return 0;
-
-            for (EventStore::const_iterator itr = _eventMap.begin(); itr != _eventMap.end(); ++itr)
-                if (eventId == (itr->second & 0x0000FFFF))
-                    return itr->first;
+            for (uint32 i = 0; i < _size; ++i)
+                if (eventId == (_events[i].Id & 0x0000FFFF))
+                    return _events[i].Time;
 
             return 0;
         }
@@ -869,7 +906,7 @@ class EventMap
          */
         uint32 GetNextEventTime() const
         {
-            return Empty() ? 0 : _eventMap.begin()->first;
+            return Empty() ? 0 : _events[0].Time;
         }
 
         /**
@@ -884,10 +921,60 @@ class EventMap
         }
 
     private:
+        // first position in [0, end) whose time is greater than the given one
+        uint32 UpperBound(uint32 time, uint32 end) const
+        {
+            uint32 first = 0;
+            while (first < end)
+            {
+                uint32 middle = first + (end - first) / 2;
+                if (_events[middle].Time <= time)
+                    first = middle + 1;
+                else
+                    end = middle;
+            }
+            return first;
+        }
+
+        void Insert(uint32 time, uint32 eventId)
+        {
+            if (_size == _capacity)
+                Reserve(_capacity * 2);
+
+            uint32 pos = UpperBound(time, _size);
+            memmove(&_events[pos + 1], &_events[pos], (_size - pos) * sizeof(Event));
+            _events[pos].Time = time;
+            _events[pos].Id = eventId;
+            ++_size;
+        }
+
+        void Erase(uint32 index)
+        {
+            memmove(&_events[index], &_events[index + 1], (_size - index - 1) * sizeof(Event));
+            --_size;
+        }
+
+        void Reserve(uint32 capacity)
+        {
+            if (capacity <= _capacity)
+                return;
+
+            Event* events = new Event[capacity];
+            memcpy(events, _events, _size * sizeof(Event));
+            if (_events != _inline)
+                delete[] _events;
+
+            _events = events;
+            _capacity = capacity;
+        }
+
         uint32 _time;
         uint32 _phase;
 
-        EventStore _eventMap;
+        Event* _events;
+        uint32 _size;
+        uint32 _capacity;
+        Event _inline[EVENT_MAP_INLINE_EVENTS];
 };
 
 #endif
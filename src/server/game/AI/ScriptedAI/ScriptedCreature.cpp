@@ -260,20 +260,20 @@ SpellInfo const* ScriptedAI::SelectSpell(Unit* target, uint32 school, uint32 mec
         return NULL;
 
     //Using the extended script system we first create a list of viable spells
-    SpellInfo const* apSpell[CREATURE_MAX_SPELLS];
-    memset(apSpell, 0, CREATURE_MAX_SPELLS * sizeof(SpellInfo*));
+    uint32 apSpell[CREATURE_MAX_SPELLS];
+    memset(apSpell, 0, CREATURE_MAX_SPELLS * sizeof(uint32));
 
     uint32 spellCount = 0;
 
-    SpellInfo const* tempSpell = NULL;
+    // ranges of the target's side, same as Unit::GetSpellMin/MaxRangeForTarget
+    uint8 rangeSide = me->IsHostileTo(target) ? 0 : 1;
 
     //Check if each spell is viable(set it to null if not)
     for (uint32 i = 0; i < CREATURE_MAX_SPELLS; i++)
     {
-        tempSpell = sSpellMgr->GetSpellInfo(me->m_spells[i]);
-
         //This spell doesn't exist
-        if (!tempSpell)
+        SpellHotInfo const* hotInfo = sSpellMgr->GetSpellHotInfo(me->m_spells[i]);
+        if (!hotInfo)
             continue;
 
         // Targets and Effects checked first as most used restrictions
@@ -285,37 +285,41 @@ SpellInfo const* ScriptedAI::SelectSpell(Unit* target, uint32 school, uint32 mec
         if (effects && !(SpellSummary[me->m_spells[i]].Effects & (1 << (effects-1))))
             continue;
 
+        uint32 spellId = me->m_spells[i];
+
         //Check for school if specified
-        if (school && (tempSpell->SchoolMask & school) == 0)
+        if (school && (hotInfo->SchoolMask & school) == 0)
             continue;
 
         //Check for spell mechanic if specified
-        if (mechanic && tempSpell->Mechanic != mechanic)
+        if (mechanic && hotInfo->Mechanic != mechanic)
             continue;
 
         //Make sure that the spell uses the requested amount of power
-        if (powerCostMin && tempSpell->ManaCost < powerCostMin)
+        if (powerCostMin && hotInfo->ManaCost < powerCostMin)
             continue;
 
-        if (powerCostMax && tempSpell->ManaCost > powerCostMax)
+        if (powerCostMax && hotInfo->ManaCost > powerCostMax)
             continue;
 
         //Continue if we don't have the mana to actually cast this spell
-        if (tempSpell->ManaCost > me->GetPower(Powers(tempSpell->PowerType)))
+        if (hotInfo->ManaCost > me->GetPower(Powers(hotInfo->PowerType)))
             continue;
 
         //Check if the spell meets our range requirements
-        if (rangeMin && me->GetSpellMinRangeForTarget(target, tempSpell) < rangeMin)
+        float spellMinRange = hotInfo->MinRange[rangeSide];
+        float spellMaxRange = hotInfo->MaxRange[rangeSide];
+        if (rangeMin && spellMinRange < rangeMin)
             continue;
-        if (rangeMax && me->GetSpellMaxRangeForTarget(target, tempSpell) > rangeMax)
+        if (rangeMax && spellMaxRange > rangeMax)
             continue;
 
         //Check if our target is in range
-        if (me->IsWithinDistInMap(target, float(me->GetSpellMinRangeForTarget(target, tempSpell))) || !me->IsWithinDistInMap(target, float(me->GetSpellMaxRangeForTarget(target, tempSpell))))
+        if (me->IsWithinDistInMap(target, spellMinRange) || !me->IsWithinDistInMap(target, spellMaxRange))
             continue;
 
         //All good so lets add it to the spell list
-        apSpell[spellCount] = tempSpell;
+        apSpell[spellCount] = spellId;
         ++spellCount;
     }
 
@@ -323,7 +327,7 @@ SpellInfo const* ScriptedAI::SelectSpell(Unit* target, uint32 school, uint32 mec
     if (!spellCount)
         return NULL;
 
-    return apSpell[urand(0, spellCount - 1)];
+    return sSpellMgr->GetSpellInfo(apSpell[urand(0, spellCount - 1)]);
 }
 
 void ScriptedAI::DoResetThreat()
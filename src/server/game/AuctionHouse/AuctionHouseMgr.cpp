@@ -354,11 +354,17 @@ bool AuctionHouseMgr::RemoveAItem(uint32 id, bool deleteFromDB)
     return true;
 }
 
-void AuctionHouseMgr::Update()
+bool AuctionHouseMgr::Update()
 {
-    mHordeAuctions.Update();
-    mAllianceAuctions.Update();
-    mNeutralAuctions.Update();
+    // one transaction for all houses, limited so a mass expiry is spread over several world ticks
+    uint32 budget = sWorld->getIntConfig(CONFIG_AUCTION_EXPIRE_PER_UPDATE);
+    if (!budget)
+        budget = std::numeric_limits<uint32>::max();
+
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    bool done = mHordeAuctions.Update(trans, budget) && mAllianceAuctions.Update(trans, budget) && mNeutralAuctions.Update(trans, budget);
+    CharacterDatabase.CommitTransaction(trans);
+    return done;
 }
 
 AuctionHouseEntry const* AuctionHouseMgr::GetAuctionHouseEntry(uint32 factionTemplateId)
@@ -406,12 +412,14 @@ void AuctionHouseObject::AddAuction(AuctionEntry* auction)
     ASSERT(auction);
 
     AuctionsMap[auction->Id] = auction;
+    ExpiryIndex.insert(std::make_pair(auction->expire_time, auction->Id));
     sScriptMgr->OnAuctionAdd(this, auction);
 }
 
 bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
 {
     bool wasInMap = AuctionsMap.erase(auction->Id) ? true : false;
+    ExpiryIndex.erase(std::make_pair(auction->expire_time, auction->Id));
 
     sScriptMgr->OnAuctionRemove(this, auction);
 
@@ -422,24 +430,23 @@ bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
     return wasInMap;
 }
 
-void AuctionHouseObject::Update()
+bool AuctionHouseObject::Update(SQLTransaction& trans, uint32& budget)
 {
     time_t checkTime = sWorld->GetGameTime() + 60;
-    ///- Handle expired auctions
-
-    // If storage is empty, no need to update. next == NULL in this case.
-    if (AuctionsMap.empty())
-        return;
-
-    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    ///- Handle expired auctions, the index is ordered by expire time so only due auctions are visited
 
-    for (AuctionEntryMap::iterator itr, iter = AuctionsMap.begin(); iter != AuctionsMap.end(); )
+    while (!ExpiryIndex.empty() && ExpiryIndex.begin()->first <= checkTime)
     {
-        itr = iter++;
-        AuctionEntry* auction = (*itr).second;
+        if (!budget)
+            return false;
+        --budget;
 
-        if (auction->expire_time > checkTime)
+        AuctionEntry* auction = GetAuction(ExpiryIndex.begin()->second);
+        if (!auction)
+        {
+            ExpiryIndex.erase(ExpiryIndex.begin());
             continue;
+        }
 
         ///- Either cancel the auction if there was no bidder
         if (auction->bidder == 0)
@@ -464,7 +471,8 @@ void AuctionHouseObject::Update()
         sAuctionMgr->RemoveAItem(auction->item_guidlow);
         RemoveAuction(auction);
     }
-    CharacterDatabase.CommitTransaction(trans);
+
+    return true;
 }
 
 void AuctionHouseObject::BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount)
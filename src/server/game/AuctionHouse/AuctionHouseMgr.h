@@ -97,6 +97,7 @@ class AuctionHouseObject
     }
 
     typedef std::map<uint32, AuctionEntry*> AuctionEntryMap;
+    typedef std::set<std::pair<time_t, uint32> > AuctionExpiryIndex;
 
     uint32 Getcount() const { return AuctionsMap.size(); }
 
@@ -113,7 +114,8 @@ class AuctionHouseObject
 
     bool RemoveAuction(AuctionEntry* auction);
 
-    void Update();
+    // Handles up to `budget` due auctions, returns false when some had to be left for the next call
+    bool Update(SQLTransaction& trans, uint32& budget);
 
     void BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
     void BuildListOwnerItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
@@ -124,6 +126,7 @@ class AuctionHouseObject
 
   private:
     AuctionEntryMap AuctionsMap;
+    AuctionExpiryIndex ExpiryIndex;                         // (expire_time, id) of all auctions in AuctionsMap
 
     // storage for "next" auction item for next Update()
     AuctionEntryMap::const_iterator next;
@@ -173,7 +176,7 @@ class AuctionHouseMgr
         void AddAItem(Item* it);
         bool RemoveAItem(uint32 id, bool deleteFromDB = false);
 
-        void Update();
+        bool Update();
 
     private:
 
@@ -741,7 +741,10 @@ void ArenaTeam::FinishGame(int32 mod, const Map* bgMap)
     // Update number of games played per season or week
     Stats.WeekGames += 1;
     Stats.SeasonGames += 1;
+}
 
+void ArenaTeam::UpdateRank()
+{
     // Update team's rank, start with rank 1 and increase until no team with more rating was found
     Stats.Rank = 1;
     ArenaTeamMgr::ArenaTeamContainer::const_iterator i = sArenaTeamMgr->GetArenaTeamMapBegin();
@@ -174,6 +174,8 @@ class ArenaTeam
 
         void FinishWeek();
         void FinishGame(int32 mod, const Map* bgMap);
+        // reads the rating of every team, only call it from the world thread
+        void UpdateRank();
 
     protected:
 
@@ -8,6 +8,7 @@
 #define _ARENATEAMMGR_H
 
 #include "ArenaTeam.h"
+#include <atomic>
 
 class ArenaTeamMgr
 {
@@ -40,7 +41,7 @@ public:
 protected:
     uint32 NextArenaTeamId;
     ArenaTeamContainer ArenaTeamStore;
-    uint32 LastArenaLogId;
+    std::atomic<uint32> LastArenaLogId; // arenas end in map threads
 };
 
 #define sArenaTeamMgr ACE_Singleton<ArenaTeamMgr, ACE_Null_Mutex>::instance()
@@ -583,7 +583,16 @@ inline void Battleground::_ProcessJoin(uint32 diff)
 
             // Announce BG starting
             if (sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
-                sWorld->SendWorldText(LANG_BG_STARTED_ANNOUNCE_WORLD, GetName(), std::min(GetMinLevel(), (uint32)80), std::min(GetMaxLevel(), (uint32)80));
+            {
+                // sent to every session, leave it to the world thread
+                std::string name = GetName();
+                uint32 minLevel = std::min(GetMinLevel(), (uint32)80);
+                uint32 maxLevel = std::min(GetMaxLevel(), (uint32)80);
+                sBattlegroundMgr->AddWorldThreadOperation([name, minLevel, maxLevel]()
+                {
+                    sWorld->SendWorldText(LANG_BG_STARTED_ANNOUNCE_WORLD, name.c_str(), minLevel, maxLevel);
+                });
+            }
 
             sScriptMgr->OnBattlegroundStart(this);
         }
@@ -600,13 +609,20 @@ inline void Battleground::_ProcessLeave(uint32 diff)
     if (m_EndTime <= 0)
     {
         m_EndTime = TIME_TO_AUTOREMOVE; // pussywizard: 0 -> TIME_TO_AUTOREMOVE
-        BattlegroundPlayerMap::iterator itr, next;
-        for (itr = m_Players.begin(); itr != m_Players.end(); itr = next)
+
+        // leaving touches groups and deserter tracking, do it in the world thread
+        // the battleground is still alive there, queued operations run before finished battlegrounds are deleted
+        Battleground* bg = this;
+        sBattlegroundMgr->AddWorldThreadOperation([bg]()
         {
-            next = itr;
-            ++next;
-            itr->second->LeaveBattleground(this); //itr is erased here!
-        }
+            BattlegroundPlayerMap::const_iterator itr, next;
+            for (itr = bg->GetPlayers().begin(); itr != bg->GetPlayers().end(); itr = next)
+            {
+                next = itr;
+                ++next;
+                itr->second->LeaveBattleground(bg); //itr is erased here!
+            }
+        });
     }
 }
 
@@ -772,14 +788,7 @@ void Battleground::EndBattleground(TeamId winnerTeamId)
     uint64 battlegroundId = 1;
     if (isBattleground() && sWorld->getBoolConfig(CONFIG_BATTLEGROUND_STORE_STATISTICS_ENABLE))
     {
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PVPSTATS_MAXID);
-        PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-        if (result)
-        {
-            Field* fields = result->Fetch();
-            battlegroundId = fields[0].GetUInt64() + 1;
-        }
+        battlegroundId = sBattlegroundMgr->GetNextPvPStatsId();
 
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PVPSTATS_BATTLEGROUND);
         stmt->setUInt64(0, battlegroundId);
@@ -1043,13 +1052,28 @@ void Battleground::EndBattleground(TeamId winnerTeamId)
 
     if (isArena() && isRated() && winnerArenaTeam && loserArenaTeam && winnerArenaTeam != loserArenaTeam)
     {
-        // save the stat changes
-        if (bValidArena) winnerArenaTeam->SaveToDB();
-        loserArenaTeam->SaveToDB();
-        // send updated arena team stats to players
-        // this way all arena team members will get notified, not only the ones who participated in this match
-        if (bValidArena) winnerArenaTeam->NotifyStatsChanged();
-        loserArenaTeam->NotifyStatsChanged();
+        // ranks compare against every arena team while other arenas may be ending in their map threads,
+        // so ranking, saving and notifying happens in the world thread
+        uint32 winnerArenaTeamId = winnerArenaTeam->GetId();
+        uint32 loserArenaTeamId = loserArenaTeam->GetId();
+        bool draw = winnerTeamId == TEAM_NEUTRAL;
+        sBattlegroundMgr->AddWorldThreadOperation([winnerArenaTeamId, loserArenaTeamId, bValidArena, draw]()
+        {
+            ArenaTeam* winnerArenaTeam = sArenaTeamMgr->GetArenaTeamById(winnerArenaTeamId);
+            ArenaTeam* loserArenaTeam = sArenaTeamMgr->GetArenaTeamById(loserArenaTeamId);
+            if (winnerArenaTeam && (bValidArena || draw))
+                winnerArenaTeam->UpdateRank();
+            if (loserArenaTeam)
+                loserArenaTeam->UpdateRank();
+
+            // save the stat changes
+            if (bValidArena && winnerArenaTeam) winnerArenaTeam->SaveToDB();
+            if (loserArenaTeam) loserArenaTeam->SaveToDB();
+            // send updated arena team stats to players
+            // this way all arena team members will get notified, not only the ones who participated in this match
+            if (bValidArena && winnerArenaTeam) winnerArenaTeam->NotifyStatsChanged();
+            if (loserArenaTeam) loserArenaTeam->NotifyStatsChanged();
+        });
     }
 
     if (winmsg_id)
@@ -44,7 +44,7 @@
 /***            BATTLEGROUND MANAGER                   ***/
 /*********************************************************/
 
-BattlegroundMgr::BattlegroundMgr() : randomBgDifficultyEntry(999, 0, 80, 80, 0), m_ArenaTesting(false), m_Testing(false), 
+BattlegroundMgr::BattlegroundMgr() : randomBgDifficultyEntry(999, 0, 80, 80, 0), m_LastPvPStatsId(0), m_ArenaTesting(false), m_Testing(false), 
     m_lastClientVisibleInstanceId(0), m_NextAutoDistributionTime(0), m_AutoDistributionTimeChecker(0), m_NextPeriodicQueueUpdateTime(5*IN_MILLISECONDS)
 {
     for (uint32 qtype = BATTLEGROUND_QUEUE_NONE; qtype < MAX_BATTLEGROUND_QUEUE_TYPES; ++qtype)
@@ -67,15 +67,31 @@ void BattlegroundMgr::DeleteAllBattlegrounds()
     m_BattlegroundTemplates.clear();
 }
 
+void BattlegroundMgr::AddWorldThreadOperation(std::function<void()> const& operation)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_WorldThreadOperationsLock);
+    m_WorldThreadOperations.push_back(operation);
+}
+
 // used to update running battlegrounds, and delete finished ones
 void BattlegroundMgr::Update(uint32 diff)
 {
-    // update all battlegrounds and delete if needed
+    // execute operations queued by battlegrounds during map updates, before any of them can be deleted
+    std::vector<std::function<void()> > operations;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_WorldThreadOperationsLock);
+        std::swap(operations, m_WorldThreadOperations);
+    }
+    for (std::vector<std::function<void()> >::const_iterator itr = operations.begin(); itr != operations.end(); ++itr)
+        (*itr)();
+
+    // battlegrounds with a map are updated in BattlegroundMap::Update, here only the remaining ones are updated and finished ones deleted
     for (BattlegroundContainer::iterator itr = m_Battlegrounds.begin(), itrDelete; itr != m_Battlegrounds.end(); )
     {
         itrDelete = itr++;
         Battleground* bg = itrDelete->second;
-        bg->Update(diff);
+        if (!bg->FindBgMap())
+            bg->Update(diff);
         if (bg->ToBeDeleted())
         {
             itrDelete->second = NULL;
@@ -13,6 +13,9 @@
 #include "BattlegroundQueue.h"
 #include "CreatureAIImpl.h"
 #include <ace/Singleton.h>
+#include <ace/Thread_Mutex.h>
+#include <atomic>
+#include <functional>
 #include <unordered_map>
 
 typedef std::map<uint32, Battleground*> BattlegroundContainer;
@@ -133,6 +136,12 @@ class BattlegroundMgr
             return BATTLEGROUND_TYPE_NONE;
         }
 
+        // battlegrounds are updated in map threads, anything touching shared state is queued here and executed in the world thread
+        void AddWorldThreadOperation(std::function<void()> const& operation);
+
+        uint64 GetNextPvPStatsId() { return ++m_LastPvPStatsId; }
+        void SetLastPvPStatsId(uint64 id) { m_LastPvPStatsId = id; }
+
         const BattlegroundContainer& GetBattlegroundList() { return m_Battlegrounds; } // pussywizard
         RandomBattlegroundSystem RandomSystem; // pussywizard
 
@@ -152,6 +161,9 @@ class BattlegroundMgr
         BattlegroundQueue m_BattlegroundQueues[MAX_BATTLEGROUND_QUEUE_TYPES];
 
         std::vector<uint64> m_ArenaQueueUpdateScheduler;
+        std::vector<std::function<void()> > m_WorldThreadOperations;
+        ACE_Thread_Mutex m_WorldThreadOperationsLock;
+        std::atomic<uint64> m_LastPvPStatsId; // battlegrounds end in map threads
         bool   m_ArenaTesting;
         bool   m_Testing;
         uint32 m_lastClientVisibleInstanceId;
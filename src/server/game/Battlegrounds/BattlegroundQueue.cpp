@@ -56,6 +56,7 @@ BattlegroundQueue::~BattlegroundQueue()
                 delete (*itr);
             m_QueuedGroups[i][j].clear();
         }
+        m_RatedTeams[i].clear();
     }
 }
 
@@ -141,6 +142,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player * leader, Group * grp, PvPDif
     ginfo->ArenaMatchmakerRating        = MatchmakerRating;
     ginfo->OpponentsTeamRating          = 0;
     ginfo->OpponentsMatchmakerRating    = 0;
+    ginfo->_isInRatedIndex              = false;
 
     ginfo->Players.clear();
 
@@ -187,6 +189,10 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player * leader, Group * grp, PvPDif
 
     //add GroupInfo to m_QueuedGroups
     m_QueuedGroups[bracketId][index].push_back(ginfo);
+    ginfo->_queueItr = --m_QueuedGroups[bracketId][index].end();
+
+    if (isRated)
+        AddToRatedIndex(ginfo);
 
     Battleground* bg = sBattlegroundMgr->GetBattlegroundTemplate(ginfo->BgTypeId);
     if (!bg)
@@ -274,22 +280,6 @@ void BattlegroundQueue::RemovePlayer(uint64 guid, bool sentToBg, uint32 playerQu
     uint32 _bracketId = groupInfo->_bracketId;
     uint32 _groupType = groupInfo->_groupType;
 
-    // find iterator
-    GroupsQueueType::iterator group_itr = m_QueuedGroups[_bracketId][_groupType].end();
-    for (GroupsQueueType::iterator k = m_QueuedGroups[_bracketId][_groupType].begin(); k != m_QueuedGroups[_bracketId][_groupType].end(); ++k)
-        if ((*k) == groupInfo)
-        {
-            group_itr = k;
-            break;
-        }
-
-    //player can't be in queue without group, but just in case
-    if (group_itr == m_QueuedGroups[_bracketId][_groupType].end())
-    {
-        ASSERT(false);
-        return;
-    }
-
     // remove player from group queue info
     std::set<uint64>::iterator pitr = groupInfo->Players.find(guid);
     ASSERT(pitr != groupInfo->Players.end());
@@ -322,7 +312,8 @@ void BattlegroundQueue::RemovePlayer(uint64 guid, bool sentToBg, uint32 playerQu
     // remove group queue info no players left
     if (groupInfo->Players.empty())
     {
-        m_QueuedGroups[_bracketId][_groupType].erase(group_itr);
+        m_QueuedGroups[_bracketId][_groupType].erase(groupInfo->_queueItr);
+        RemoveFromRatedIndex(groupInfo);
         delete groupInfo;
         return;
     }
@@ -542,9 +533,8 @@ bool BattlegroundQueue::CheckPremadeMatch(BattlegroundBracketId bracket_id, uint
             {
                 if (!(*itr)->IsInvitedToBGInstanceGUID && ((*itr)->JoinTime < time_before || (*itr)->Players.size() < MinPlayersPerTeam))
                 {
-                    (*itr)->_groupType = BG_QUEUE_NORMAL_ALLIANCE + i; // pussywizard: update GroupQueueInfo internal variable
-                    m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].push_front((*itr));
-                    m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].erase(itr++);
+                    GroupQueueInfo* ginfo = *itr++;
+                    MoveGroupToQueue(ginfo, BG_QUEUE_NORMAL_ALLIANCE + i);
                     continue;
                 }
                 ++itr;
@@ -622,20 +612,9 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(BattlegroundBracketId bracke
 
                                 for (GroupsQueueType::iterator pitr = m_SelectionPools[wrongTeamId].SelectedGroups.begin(); pitr != m_SelectionPools[wrongTeamId].SelectedGroups.end(); ++pitr)
                                 {
-                                    // update internal GroupQueueInfo data
+                                    // update internal GroupQueueInfo data and move it to the queue of the other faction
                                     (*pitr)->teamId = wrongTeamId;
-                                    (*pitr)->_groupType = BG_QUEUE_NORMAL_ALLIANCE + wrongTeamId;
-
-                                    // add GroupQueueInfo to new queue
-                                    m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + wrongTeamId].push_front(*pitr);
-
-                                    // remove GroupQueueInfo from old queue
-                                    for (GroupsQueueType::iterator qitr = m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].begin(); qitr != m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].end(); ++qitr)
-                                        if (*qitr == *pitr)
-                                        {
-                                            m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].erase(qitr);
-                                            break;
-                                        }
+                                    MoveGroupToQueue(*pitr, BG_QUEUE_NORMAL_ALLIANCE + wrongTeamId);
                                 }
 
                                 return true;
@@ -785,156 +764,184 @@ void BattlegroundQueue::BattlegroundQueueUpdate(BattlegroundBracketId bracket_id
     // check if can start new rated arenas (can create many in single queue update)
     else if (bg_template->isArena())
     {
-        // pussywizard: everything inside this section is mine, do NOT destroy!
-
-        const uint32 currMSTime = World::GetGameTimeMS();
-        const uint32 discardTime = sBattlegroundMgr->GetRatingDiscardTimer();
-        const uint32 maxDefaultRatingDifference = (MaxPlayersPerTeam > 2 ? 300 : 200);
-        const uint32 maxCountedMMR = 2500;
-
-        // we need to find 2 teams which will play next game
-        GroupsQueueType::iterator itr_teams[BG_TEAMS_COUNT];
-
-        bool increaseItr = true;
-        bool reverse1 = urand(0, 1) ? true : false;
+        // teams are processed in join order (random faction first), opponents are looked up in the mmr index
+        std::vector<GroupQueueInfo*> teams;
+        bool reverse = urand(0, 1) ? true : false;
         for (uint8 ii = BG_QUEUE_PREMADE_ALLIANCE; ii <= BG_QUEUE_PREMADE_HORDE; ii++)
         {
-            uint8 i = reverse1 ? (BG_QUEUE_PREMADE_HORDE - ii) : ii;
-            for (GroupsQueueType::iterator itr = m_QueuedGroups[bracket_id][i].begin(); itr != m_QueuedGroups[bracket_id][i].end(); (increaseItr ? ++itr : itr))
+            uint8 i = reverse ? (BG_QUEUE_PREMADE_HORDE - ii) : ii;
+            for (GroupsQueueType::const_iterator itr = m_QueuedGroups[bracket_id][i].begin(); itr != m_QueuedGroups[bracket_id][i].end(); ++itr)
+                // if arenaRatedTeamId is set - look for oponents only for one team, if not - pair every possible team
+                if ((*itr)->_isInRatedIndex && (!arenaRatedTeamId || arenaRatedTeamId == (*itr)->ArenaTeamId))
+                    teams.push_back(*itr);
+        }
+
+        for (std::vector<GroupQueueInfo*>::const_iterator itr = teams.begin(); itr != teams.end(); ++itr)
+        {
+            // already picked as an opponent of a previous team
+            if (!(*itr)->_isInRatedIndex)
+                continue;
+
+            GroupQueueInfo* oponent = FindRatedOpponent(*itr, MaxPlayersPerTeam);
+            if (!oponent)
             {
-                increaseItr = true;
+                if (arenaRatedTeamId)
+                    return;
+                continue;
+            }
 
-                // if arenaRatedTeamId is set - look for oponents only for one team, if not - pair every possible team
-                if (arenaRatedTeamId != 0 && arenaRatedTeamId != (*itr)->ArenaTeamId)
-                    continue;
-                if ((*itr)->IsInvitedToBGInstanceGUID)
-                    continue;
+            // the team keeps its side, the oponent takes the other one
+            GroupQueueInfo* arenaTeams[BG_TEAMS_COUNT];
+            arenaTeams[(*itr)->_groupType] = *itr;
+            arenaTeams[(*itr)->_groupType == BG_QUEUE_PREMADE_ALLIANCE ? TEAM_HORDE : TEAM_ALLIANCE] = oponent;
 
-                uint32 MMR1 = std::min((*itr)->ArenaMatchmakerRating, maxCountedMMR);
+            GroupQueueInfo* aTeam = arenaTeams[TEAM_ALLIANCE];
+            GroupQueueInfo* hTeam = arenaTeams[TEAM_HORDE];
+            Battleground* arena = sBattlegroundMgr->CreateNewBattleground(m_bgTypeId, bracketEntry->minLevel, bracketEntry->maxLevel, m_arenaType, true);
+            if (!arena)
+                return;
 
-                GroupsQueueType::iterator oponentItr;
-                uint8 oponentQueue = BG_QUEUE_MAX;
-                uint32 minOponentMMRDiff = 0xffffffff;
-                uint8 oponentValid = 0;
+            aTeam->OpponentsTeamRating = hTeam->ArenaTeamRating;
+            hTeam->OpponentsTeamRating = aTeam->ArenaTeamRating;
+            aTeam->OpponentsMatchmakerRating = hTeam->ArenaMatchmakerRating;
+            hTeam->OpponentsMatchmakerRating = aTeam->ArenaMatchmakerRating;
 
-                bool reverse2 = urand(0, 1) ? true : false;
-                for (uint8 jj = BG_QUEUE_PREMADE_ALLIANCE; jj <= BG_QUEUE_PREMADE_HORDE; jj++)
-                {
-                    uint8 j = reverse2 ? (BG_QUEUE_PREMADE_HORDE - jj) : jj;
-                    bool brk = false;
-                    for (GroupsQueueType::iterator itr2 = m_QueuedGroups[bracket_id][j].begin(); itr2 != m_QueuedGroups[bracket_id][j].end(); ++itr2)
-                    {
-                        if ((*itr)->ArenaTeamId == (*itr2)->ArenaTeamId)
-                            continue;
-                        if ((*itr2)->IsInvitedToBGInstanceGUID)
-                            continue;
-                        uint32 MMR2 = std::min((*itr2)->ArenaMatchmakerRating, maxCountedMMR);
-                        uint32 MMRDiff = (MMR2 >= MMR1 ? MMR2 - MMR1 : MMR1 - MMR2);
-
-                        uint32 maxAllowedDiff = maxDefaultRatingDifference;
-                        uint32 shorterWaitTime, longerWaitTime;
-                        if (currMSTime - (*itr)->JoinTime <= currMSTime - (*itr2)->JoinTime)
-                        {
-                            shorterWaitTime = currMSTime - (*itr)->JoinTime;
-                            longerWaitTime = currMSTime - (*itr2)->JoinTime;
-                        }
-                        else
-                        {
-                            shorterWaitTime = currMSTime - (*itr2)->JoinTime;
-                            longerWaitTime = currMSTime - (*itr)->JoinTime;
-                        }
-                        if (longerWaitTime >= discardTime)
-                            maxAllowedDiff += 150;
-                        maxAllowedDiff += shorterWaitTime / 600; // increased by 100 for each minute
+            // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
+            if (aTeam->_groupType != BG_QUEUE_PREMADE_ALLIANCE)
+                MoveGroupToQueue(aTeam, BG_QUEUE_PREMADE_ALLIANCE);
+            if (hTeam->_groupType != BG_QUEUE_PREMADE_HORDE)
+                MoveGroupToQueue(hTeam, BG_QUEUE_PREMADE_HORDE);
 
-                        // now check if this team is more appropriate than previous ones:
+            RemoveFromRatedIndex(aTeam);
+            RemoveFromRatedIndex(hTeam);
 
-                        if (currMSTime - (*itr)->JoinTime >= 20 * MINUTE * IN_MILLISECONDS && (oponentValid < 3 || MMRDiff < minOponentMMRDiff)) // after 20 minutes of waiting, pair with closest mmr, regardless the difference
-                        {
-                            oponentValid = 3;
-                            minOponentMMRDiff = MMRDiff; oponentItr = itr2; oponentQueue = j;
-                        }
-                        else if (MMR1 >= 2000 && MMR2 >= 2000 && longerWaitTime >= 2 * discardTime && (oponentValid < 2 || MMRDiff < minOponentMMRDiff)) // after 6 minutes of waiting, pair any 2000+ vs 2000+
-                        {
-                            oponentValid = 2;
-                            minOponentMMRDiff = MMRDiff; oponentItr = itr2; oponentQueue = j;
-                        }
-                        else if (oponentValid < 2 && MMRDiff < minOponentMMRDiff)
-                        {
-                            if (!oponentValid)
-                            {
-                                minOponentMMRDiff = MMRDiff; oponentItr = itr2; oponentQueue = j;
-                                if (MMRDiff <= maxAllowedDiff)
-                                    oponentValid = 1;
-                            }
-                            if ((MMR1 < 1800 || MMR2 < 1800) && MaxPlayersPerTeam == 2 && MMRDiff <= maxDefaultRatingDifference) // in 2v2 below 1800 mmr - priority for default allowed difference
-                            {
-                                minOponentMMRDiff = MMRDiff; oponentItr = itr2; oponentQueue = j;
-                                brk = true;
-                                break;
-                            }
-                        }
-                    }
-                    if (brk)
-                        break;
-                }
+            arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
+            arena->SetArenaMatchmakerRating(TEAM_HORDE, hTeam->ArenaMatchmakerRating);
+            BattlegroundMgr::InviteGroupToBG(aTeam, arena, TEAM_ALLIANCE);
+            BattlegroundMgr::InviteGroupToBG(hTeam, arena, TEAM_HORDE);
 
-                if (oponentQueue != BG_QUEUE_MAX)
-                {
-                    if (oponentValid)
-                    {
-                        itr_teams[i] = itr;
-                        itr_teams[i == 0 ? 1 : 0] = oponentItr;
+            arena->StartBattleground();
 
-                        {
-                            GroupQueueInfo* aTeam = *itr_teams[TEAM_ALLIANCE];
-                            GroupQueueInfo* hTeam = *itr_teams[TEAM_HORDE];
-                            Battleground* arena = sBattlegroundMgr->CreateNewBattleground(m_bgTypeId, bracketEntry->minLevel, bracketEntry->maxLevel, m_arenaType, true);
-                            if (!arena)
-                                return;
-
-                            aTeam->OpponentsTeamRating = hTeam->ArenaTeamRating;
-                            hTeam->OpponentsTeamRating = aTeam->ArenaTeamRating;
-                            aTeam->OpponentsMatchmakerRating = hTeam->ArenaMatchmakerRating;
-                            hTeam->OpponentsMatchmakerRating = aTeam->ArenaMatchmakerRating;
-
-                            // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
-                            if (aTeam->teamId != TEAM_ALLIANCE)
-                            {
-                                aTeam->_groupType = BG_QUEUE_PREMADE_ALLIANCE;
-                                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
-                                increaseItr = false;
-                                itr = m_QueuedGroups[bracket_id][i].begin();
-                            }
-                            if (hTeam->teamId != TEAM_HORDE)
-                            {
-                                hTeam->_groupType = BG_QUEUE_PREMADE_HORDE;
-                                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
-                                increaseItr = false;
-                                itr = m_QueuedGroups[bracket_id][i].begin();
-                            }
+            if (arenaRatedTeamId)
+                return;
+        }
+    }
+}
+
+// finds the best oponent for a rated arena team by walking the mmr index outwards from the team,
+// so candidates come in increasing mmr difference and only teams inside the team's window are visited
+GroupQueueInfo* BattlegroundQueue::FindRatedOpponent(GroupQueueInfo* ginfo, uint32 maxPlayersPerTeam) const
+{
+    const uint32 currMSTime = World::GetGameTimeMS();
+    const uint32 discardTime = sBattlegroundMgr->GetRatingDiscardTimer();
+    const uint32 maxDefaultRatingDifference = (maxPlayersPerTeam > 2 ? 300 : 200);
+
+    RatedTeamIndex const& index = m_RatedTeams[ginfo->_bracketId];
+    uint32 MMR1 = ginfo->_ratedItr->first;
+    uint32 waitTime = currMSTime - ginfo->JoinTime;
+
+    // after 20 minutes of waiting, pair with closest mmr, regardless the difference
+    bool anyDifference = waitTime >= 20 * MINUTE * IN_MILLISECONDS;
+
+    // the allowed difference grows with the shorter wait time of both teams, which is at most this team's wait time
+    uint32 window = maxDefaultRatingDifference + 150 + waitTime / 600;
+    uint32 minMMR = MMR1 > window ? MMR1 - window : 0;
+    uint32 maxMMR = MMR1 + window;
+    if (anyDifference)
+    {
+        minMMR = 0;
+        maxMMR = ARENA_QUEUE_MAX_COUNTED_MMR;
+    }
+    else if (MMR1 >= 2000) // after 6 minutes of waiting any 2000+ team can be paired with any other 2000+ team
+    {
+        minMMR = std::min<uint32>(minMMR, 2000);
+        maxMMR = std::max<uint32>(maxMMR, ARENA_QUEUE_MAX_COUNTED_MMR);
+    }
 
-                            arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
-                            arena->SetArenaMatchmakerRating(TEAM_HORDE, hTeam->ArenaMatchmakerRating);
-                            BattlegroundMgr::InviteGroupToBG(aTeam, arena, TEAM_ALLIANCE);
-                            BattlegroundMgr::InviteGroupToBG(hTeam, arena, TEAM_HORDE);
+    GroupQueueInfo* oponent = NULL;
+    uint8 oponentValid = 0;
 
-                            arena->StartBattleground();
-                        }
+    // the next candidate below is the one before lower, the next one above is upper
+    RatedTeamIndex::const_iterator lower = ginfo->_ratedItr;
+    RatedTeamIndex::const_iterator upper = ginfo->_ratedItr;
+    ++upper;
 
-                        if (arenaRatedTeamId)
-                            return;
-                        else
-                            continue;
-                    }
-                    else if (arenaRatedTeamId)
-                        return;
-                }
-            }
+    for (;;)
+    {
+        bool hasLower = lower != index.begin() && std::prev(lower)->first >= minMMR;
+        bool hasUpper = upper != index.end() && upper->first <= maxMMR;
+        if (!hasLower && !hasUpper)
+            break;
+
+        RatedTeamIndex::const_iterator itr;
+        if (hasLower && (!hasUpper || MMR1 - std::prev(lower)->first <= upper->first - MMR1))
+            itr = --lower;
+        else
+            itr = upper++;
+
+        GroupQueueInfo* candidate = itr->second;
+        if (candidate->ArenaTeamId == ginfo->ArenaTeamId)
+            continue;
+
+        uint32 MMR2 = itr->first;
+        uint32 MMRDiff = (MMR2 >= MMR1 ? MMR2 - MMR1 : MMR1 - MMR2);
+        uint32 candidateWaitTime = currMSTime - candidate->JoinTime;
+        uint32 shorterWaitTime = std::min(waitTime, candidateWaitTime);
+        uint32 longerWaitTime = std::max(waitTime, candidateWaitTime);
+
+        uint32 maxAllowedDiff = maxDefaultRatingDifference;
+        if (longerWaitTime >= discardTime)
+            maxAllowedDiff += 150;
+        maxAllowedDiff += shorterWaitTime / 600; // increased by 100 for each minute
+
+        uint8 valid = 0;
+        if (anyDifference)
+            valid = 3;
+        else if (MMR1 >= 2000 && MMR2 >= 2000 && longerWaitTime >= 2 * discardTime) // after 6 minutes of waiting, pair any 2000+ vs 2000+
+            valid = 2;
+        else if (MMRDiff <= maxAllowedDiff)
+            valid = 1;
+
+        // the first candidate of each validity is the closest one
+        if (valid > oponentValid)
+        {
+            oponent = candidate;
+            oponentValid = valid;
         }
+
+        if (oponentValid >= 2 || (oponentValid == 1 && MMR1 < 2000))
+            break;
+
+        // only a 2000+ team waiting long enough can still beat a valid oponent
+        if (oponentValid == 1)
+            minMMR = std::max<uint32>(minMMR, 2000);
     }
+
+    return oponent;
+}
+
+void BattlegroundQueue::MoveGroupToQueue(GroupQueueInfo* ginfo, uint8 groupType)
+{
+    m_QueuedGroups[ginfo->_bracketId][ginfo->_groupType].erase(ginfo->_queueItr);
+    ginfo->_groupType = groupType;
+    m_QueuedGroups[ginfo->_bracketId][groupType].push_front(ginfo);
+    ginfo->_queueItr = m_QueuedGroups[ginfo->_bracketId][groupType].begin();
+}
+
+void BattlegroundQueue::AddToRatedIndex(GroupQueueInfo* ginfo)
+{
+    uint32 mmr = std::min<uint32>(ginfo->ArenaMatchmakerRating, ARENA_QUEUE_MAX_COUNTED_MMR);
+    ginfo->_ratedItr = m_RatedTeams[ginfo->_bracketId].insert(std::make_pair(mmr, ginfo));
+    ginfo->_isInRatedIndex = true;
+}
+
+void BattlegroundQueue::RemoveFromRatedIndex(GroupQueueInfo* ginfo)
+{
+    if (!ginfo->_isInRatedIndex)
+        return;
+
+    m_RatedTeams[ginfo->_bracketId].erase(ginfo->_ratedItr);
+    ginfo->_isInRatedIndex = false;
 }
 
 uint32 BattlegroundQueue::GetPlayersCountInGroupsQueue(BattlegroundBracketId bracketId, BattlegroundQueueGroupTypes bgqueue)
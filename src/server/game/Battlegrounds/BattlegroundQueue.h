@@ -15,6 +15,7 @@
 #include <deque>
 
 #define COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME 10
+#define ARENA_QUEUE_MAX_COUNTED_MMR 2500                   // higher matchmaker ratings are treated as this value when pairing rated teams
 
 struct GroupQueueInfo                                       // stores information about the group in queue (also used when joined as solo!)
 {
@@ -36,6 +37,9 @@ struct GroupQueueInfo                                       // stores informatio
     // pussywizard: for internal use
     uint8 _bracketId;
     uint8 _groupType;
+    std::list<GroupQueueInfo*>::iterator _queueItr;                  // position in m_QueuedGroups[_bracketId][_groupType]
+    std::multimap<uint32, GroupQueueInfo*>::iterator _ratedItr;       // position in m_RatedTeams[_bracketId], valid if _isInRatedIndex
+    bool _isInRatedIndex;
 };
 
 enum BattlegroundQueueGroupTypes
@@ -111,7 +115,15 @@ class BattlegroundQueue
 
         //one selection pool for horde, other one for alliance
         SelectionPool m_SelectionPools[BG_TEAMS_COUNT];
+
+        // rated arena teams which are not invited yet, ordered by matchmaker rating (capped at ARENA_QUEUE_MAX_COUNTED_MMR)
+        typedef std::multimap<uint32, GroupQueueInfo*> RatedTeamIndex;
+        RatedTeamIndex m_RatedTeams[MAX_BATTLEGROUND_BRACKETS];
     private:
+        void MoveGroupToQueue(GroupQueueInfo* ginfo, uint8 groupType);
+        void AddToRatedIndex(GroupQueueInfo* ginfo);
+        void RemoveFromRatedIndex(GroupQueueInfo* ginfo);
+        GroupQueueInfo* FindRatedOpponent(GroupQueueInfo* ginfo, uint32 maxPlayersPerTeam) const;
 
         BattlegroundTypeId m_bgTypeId;
         ArenaType m_arenaType;
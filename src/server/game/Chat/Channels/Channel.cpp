@@ -201,7 +201,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     pinfo.lastSpeakTime = 0;
     pinfo.plrPtr = player;
 
-    playersStore[guid] = pinfo;
+    AddMember(pinfo);
 
     if (_channelRights.joinMessage.length())
         ChatHandler(player->GetSession()).PSendSysMessage("%s", _channelRights.joinMessage.c_str());
@@ -259,7 +259,7 @@ void Channel::LeaveChannel(Player* player, bool send)
 
     bool changeowner = playersStore[guid].IsOwner();
 
-    playersStore.erase(guid);
+    RemoveMember(guid);
     if (_announce && (!AccountMgr::IsGMAccount(player->GetSession()->GetSecurity()) ||
                        !sWorld->getBoolConfig(CONFIG_SILENTLY_GM_JOIN_TO_CHANNEL)))
     {
@@ -425,7 +425,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
 
     if (isOnChannel)
     {
-        playersStore.erase(victim);
+        RemoveMember(victim);
         bad->LeftChannel(this);
         RemoveWatching(bad);
         LeaveNotify(bad);
@@ -823,11 +823,11 @@ void Channel::EveryoneSayToSelf(const char *what)
     data << what;
     data << uint8(0);
 
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
+    for (uint32 i = 0; i < _memberSessions.size(); ++i)
     {
-        data.put(5, i->first);
-        data.put(17+_name.size()+1, i->first);
-        i->second.plrPtr->GetSession()->SendPacket(&data);
+        data.put(5, _memberGuids[i]);
+        data.put(17+_name.size()+1, _memberGuids[i]);
+        _memberSessions[i]->SendPacket(&data);
     }
 }
 
@@ -925,18 +925,70 @@ void Channel::SetOwner(uint64 guid, bool exclaim)
     }
 }
 
+void Channel::AddMember(PlayerInfo const& pinfo)
+{
+    PlayerInfo& info = playersStore[pinfo.player];
+    info = pinfo;
+    info.slot = _memberSessions.size();
+
+    _memberSessions.push_back(pinfo.plrPtr->GetSession());
+    _memberGuids.push_back(pinfo.player);
+}
+
+void Channel::RemoveMember(uint64 guid)
+{
+    PlayerContainer::iterator itr = playersStore.find(guid);
+    if (itr == playersStore.end())
+        return;
+
+    // entries created by operator[] for non members have no slot
+    uint32 slot = itr->second.slot;
+    playersStore.erase(itr);
+    if (slot >= _memberGuids.size() || _memberGuids[slot] != guid)
+        return;
+
+    // move the last member into the freed slot
+    uint32 last = _memberGuids.size() - 1;
+    if (slot != last)
+    {
+        _memberSessions[slot] = _memberSessions[last];
+        _memberGuids[slot] = _memberGuids[last];
+        playersStore[_memberGuids[slot]].slot = slot;
+    }
+
+    _memberSessions.pop_back();
+    _memberGuids.pop_back();
+}
+
 void Channel::SendToAll(WorldPacket* data, uint64 guid)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(GUID_LOPART(guid)))
-            i->second.plrPtr->GetSession()->SendPacket(data);
+    // members ignoring the sender are found through the sender's reverse ignore index, usually there are none
+    std::set<uint32> const* ignoring = guid ? sSocialMgr->GetIgnoreListers(GUID_LOPART(guid)) : NULL;
+    if (!ignoring)
+    {
+        for (std::vector<WorldSession*>::const_iterator itr = _memberSessions.begin(); itr != _memberSessions.end(); ++itr)
+            (*itr)->SendPacket(data);
+        return;
+    }
+
+    std::vector<bool> skip(_memberSessions.size(), false);
+    for (std::set<uint32>::const_iterator itr = ignoring->begin(); itr != ignoring->end(); ++itr)
+    {
+        PlayerContainer::const_iterator member = playersStore.find(MAKE_NEW_GUID(*itr, 0, HIGHGUID_PLAYER));
+        if (member != playersStore.end() && member->second.slot < skip.size() && _memberGuids[member->second.slot] == member->first)
+            skip[member->second.slot] = true;
+    }
+
+    for (uint32 i = 0; i < _memberSessions.size(); ++i)
+        if (!skip[i])
+            _memberSessions[i]->SendPacket(data);
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, uint64 who)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (i->first != who)
-            i->second.plrPtr->GetSession()->SendPacket(data);
+    for (uint32 i = 0; i < _memberSessions.size(); ++i)
+        if (_memberGuids[i] != who)
+            _memberSessions[i]->SendPacket(data);
 }
 
 void Channel::SendToOne(WorldPacket* data, uint64 who)
@@ -10,6 +10,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "Common.h"
 
@@ -17,6 +18,7 @@
 #include "WorldPacket.h"
 
 class Player;
+class WorldSession;
 
 #define CHANNEL_BAN_DURATION            DAY*60
 
@@ -141,6 +143,9 @@ class Channel
         uint8 flags;
         uint32 lastSpeakTime; // pussywizard
         Player* plrPtr; // pussywizard
+        uint32 slot; // index in the member session arrays
+
+        PlayerInfo() : player(0), flags(0), lastSpeakTime(0), plrPtr(NULL), slot(uint32(-1)) { }
 
         bool HasFlag(uint8 flag) const { return flags & flag; }
         void SetFlag(uint8 flag) { if (!HasFlag(flag)) flags |= flag; }
@@ -264,6 +269,9 @@ class Channel
         void SendToOne(WorldPacket* data, uint64 who);
         void SendToAllWatching(WorldPacket* data);
 
+        void AddMember(PlayerInfo const& pinfo);
+        void RemoveMember(uint64 guid);
+
         bool IsOn(uint64 who) const { return playersStore.find(who) != playersStore.end(); }
         bool IsBanned(uint64 guid) const;
 
@@ -324,6 +332,9 @@ class Channel
         std::string _password;
         ChannelRights _channelRights;
         PlayerContainer playersStore;
+        // members in contiguous arrays for broadcasting, PlayerInfo::slot is the index
+        std::vector<WorldSession*> _memberSessions;
+        std::vector<uint64> _memberGuids;
         BannedContainer bannedStore;
         PlayersWatchingContainer playersWatchingStore;
 };
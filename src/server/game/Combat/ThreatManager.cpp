@@ -234,6 +234,7 @@ void ThreatContainer::clearReferences()
     }
 
     iThreatList.clear();
+    iReferenceByGuid.clear();
 }
 
 //============================================================
@@ -243,15 +244,8 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit* victim) const
     if (!victim)
         return NULL;
 
-    uint64 const guid = victim->GetGUID();
-    for (ThreatContainer::StorageType::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-    {
-        HostileReference *ref = (*i);
-        if (ref && ref->getUnitGuid() == guid)
-            return ref;
-    }
-
-    return NULL;
+    std::unordered_map<uint64, HostileReference*>::const_iterator itr = iReferenceByGuid.find(victim->GetGUID());
+    return itr != iReferenceByGuid.end() ? itr->second : NULL;
 }
 
 //============================================================
@@ -275,11 +269,52 @@ void ThreatContainer::modifyThreatPercent(Unit* victim, int32 percent)
 
 //============================================================
 // Check if the list is dirty and sort if necessary
+// Between two updates usually only a few references change their threat, so the list
+// is still nearly sorted. A stable insertion pass restores the order in about one walk
+// over the list and gives the same result as a stable sort. If too many references
+// turn out to be misplaced, the remaining work is handed to list::sort.
 
 void ThreatContainer::update()
 {
     if (iDirty && iThreatList.size() > 1)
-        iThreatList.sort(Trinity::ThreatOrderPred());
+    {
+        Trinity::ThreatOrderPred pred;
+        uint32 moves = 0;
+        uint32 const maxMoves = iThreatList.size() / 4 + 1;
+
+        StorageType::iterator itr = iThreatList.begin();
+        for (++itr; itr != iThreatList.end();)
+        {
+            StorageType::iterator next = itr;
+            ++next;
+
+            StorageType::iterator prev = itr;
+            --prev;
+            if (pred(*itr, *prev))
+            {
+                if (++moves > maxMoves)
+                {
+                    iThreatList.sort(pred);
+                    break;
+                }
+
+                // move back behind the last reference with at least the same threat (stable)
+                StorageType::iterator pos = prev;
+                while (pos != iThreatList.begin())
+                {
+                    StorageType::iterator before = pos;
+                    --before;
+                    if (!pred(*itr, *before))
+                        break;
+                    pos = before;
+                }
+
+                iThreatList.splice(pos, iThreatList, itr);
+            }
+
+            itr = next;
+        }
+    }
 
     iDirty = false;
 }
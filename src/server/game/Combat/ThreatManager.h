@@ -13,6 +13,7 @@
 #include "UnitEvents.h"
 
 #include <list>
+#include <unordered_map>
 
 //==============================================================
 
@@ -160,11 +161,13 @@ class ThreatContainer
         void remove(HostileReference* hostileRef)
         {
             iThreatList.remove(hostileRef);
+            iReferenceByGuid.erase(hostileRef->getUnitGuid());
         }
 
         void addReference(HostileReference* hostileRef)
         {
             iThreatList.push_back(hostileRef);
+            iReferenceByGuid[hostileRef->getUnitGuid()] = hostileRef;
         }
 
         void clearReferences();
@@ -173,6 +176,8 @@ class ThreatContainer
         void update();
 
         StorageType iThreatList;
+        // guid lookup for getReferenceByTarget, called for every threat change
+        std::unordered_map<uint64, HostileReference*> iReferenceByGuid;
         bool iDirty;
 };
 
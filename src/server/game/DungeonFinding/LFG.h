@@ -11,6 +11,7 @@
 #include "ObjectDefines.h"
 #include "SharedDefines.h"
 #include "WorldPacket.h"
+#include <bitset>
 
 namespace lfg
 {
@@ -99,6 +100,9 @@ typedef std::list<uint64> LfgGuidList;
 typedef std::map<uint64, uint8> LfgRolesMap;
 typedef std::map<uint64, uint64> LfgGroupsMap;
 
+#define LFG_DUNGEON_MASK_SIZE 512                          // LFGDungeons.dbc ids must be below this value
+typedef std::bitset<LFG_DUNGEON_MASK_SIZE> LfgDungeonMask;
+
 class Lfg5Guids
 {
 public:
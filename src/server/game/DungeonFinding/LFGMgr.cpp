@@ -36,6 +36,7 @@ LFGMgr::LFGMgr(): m_lfgProposalId(1), m_options(sWorld->getIntConfig(CONFIG_LFG_
     {
         m_raidBrowserUpdateTimer[team] = 10000;
         m_raidBrowserLastUpdatedDungeonId[team] = 0;
+        m_raidBrowserStatsCacheTimer[team] = 5000;
     }
 }
 
@@ -170,6 +171,12 @@ void LFGMgr::LoadLFGDungeons(bool reload /* = false */)
         if (!dungeon)
             continue;
 
+        if (dungeon->ID >= LFG_DUNGEON_MASK_SIZE)
+        {
+            sLog->outError("LFGMgr::LoadLFGDungeons: dungeon %u does not fit in LFG_DUNGEON_MASK_SIZE, skipped", dungeon->ID);
+            continue;
+        }
+
         switch (dungeon->type)
         {
             case LFG_TYPE_DUNGEON:
@@ -809,6 +816,7 @@ void LFGMgr::JoinRaidBrowser(Player* player, uint8 roles, LfgDungeonSet& dungeon
         {
             RaidBrowserStore[player->GetTeamId()][*itr][player->GetGUIDLow()] = entry;
             RBUsedDungeonsStore[player->GetTeamId()].insert(*itr);
+            RBChangedEntriesStore[player->GetTeamId()].insert(std::make_pair(*itr, player->GetGUIDLow()));
         }
 }
 
@@ -817,7 +825,8 @@ void LFGMgr::LeaveRaidBrowser(uint64 guid)
     uint32 guidLow = GUID_LOPART(guid);
     for (uint8 team=0; team<2; ++team)
         for (RBStoreMap::iterator itr = RaidBrowserStore[team].begin(); itr != RaidBrowserStore[team].end(); ++itr)
-            itr->second.erase(guidLow);
+            if (itr->second.erase(guidLow))
+                RBChangedEntriesStore[team].insert(std::make_pair(itr->first, guidLow));
 }
 
 void LFGMgr::SendRaidBrowserJoinedPacket(Player* p, LfgDungeonSet& dungeons, std::string comment)
@@ -859,8 +868,18 @@ void LFGMgr::LfrSearchRemove(Player* p)
 
 void LFGMgr::SendRaidBrowserCachedList(Player* player, uint32 dungeonId)
 {
-    RBCacheMap::iterator itr = RBCacheStore[player->GetTeamId()].find(dungeonId);
-    if (itr != RBCacheStore[player->GetTeamId()].end())
+    uint8 team = player->GetTeamId();
+
+    // full packet is built only when someone asks for it and the list changed since it was built
+    if (RBCacheDirtyStore[team].erase(dungeonId))
+    {
+        WorldPacket& fullPacket = RBCacheStore[team][dungeonId];
+        fullPacket.Initialize(SMSG_UPDATE_LFG_LIST, 1000);
+        RBPacketBuildFull(fullPacket, dungeonId, RBInternalInfoStorePrev[team][dungeonId]);
+    }
+
+    RBCacheMap::iterator itr = RBCacheStore[team].find(dungeonId);
+    if (itr != RBCacheStore[team].end())
     {
         player->GetSession()->SendPacket(&(itr->second));
         return;
@@ -885,237 +904,340 @@ void LFGMgr::UpdateRaidBrowser(uint32 diff)
             m_raidBrowserUpdateTimer[team] -= diff;
         else
             m_raidBrowserUpdateTimer[team] = 0;
+
+        // stats of listed players are gathered again after some time, even while the periodic update is skipped
+        if (m_raidBrowserStatsCacheTimer[team] > diff)
+            m_raidBrowserStatsCacheTimer[team] -= diff;
+        else
+        {
+            m_raidBrowserStatsCacheTimer[team] = 5000;
+            RBStatsCacheStore[team].clear();
+        }
+    }
+
+    // joined / left players and changed comments are applied right away, one entry at a time, even if the server is busy
+    for (uint8 team=0; team<2; ++team)
+    {
+        for (RBChangedEntriesSet::const_iterator itr = RBChangedEntriesStore[team].begin(); itr != RBChangedEntriesStore[team].end(); ++itr)
+            RBUpdateEntry(team, itr->first, itr->second);
+        RBChangedEntriesStore[team].clear();
     }
 
+    // stats of listed players have no change events, they are refreshed periodically and that can wait
     if (getMSTimeDiff(World::GetGameTimeMS(), getMSTime()) > (70*7)/5) // prevent lagging
         return;
 
-    uint64 guid, groupGuid, instanceGuid;
-    uint8 level, Class, race, talents[3];
-    float iLevel, mp5, mp5combat, baseAP, rangedAP;
-    int32 spellDamage, spellHeal;
-    uint32 dungeonId, encounterMask, maxPower;
-    uint32 deletedCounter, groupCounter, playerCounter;
-    ByteBuffer buffer_deleted, buffer_groups, buffer_players;
-    std::string emptyComment;
-    std::set<uint64> deletedGroups, deletedGroupsToErase;
-    RBInternalInfoMap copy;
-
     for (uint8 team=0; team<2; ++team)
     {
         if (m_raidBrowserLastUpdatedDungeonId[team] == 0) // new loop
         {
             if (m_raidBrowserUpdateTimer[team] > 0) // allowed only with some time interval
                 continue;
-            else // reset timer
-                m_raidBrowserUpdateTimer[team] = 5000;
+
+            // reset timer
+            m_raidBrowserUpdateTimer[team] = 5000;
         }
 
-        RBUsedDungeonsSet::const_iterator neitr, titr;
-        for (neitr = RBUsedDungeonsStore[team].begin(); neitr != RBUsedDungeonsStore[team].end(); )
+        // go to next dungeon than previously (one dungeon updated in one LFGMgr::UpdateRaidBrowser)
+        RBUsedDungeonsSet::const_iterator itr = RBUsedDungeonsStore[team].upper_bound(m_raidBrowserLastUpdatedDungeonId[team]);
+        if (itr == RBUsedDungeonsStore[team].end())
         {
-            titr = neitr++;
-            dungeonId = (*titr);
+            m_raidBrowserLastUpdatedDungeonId[team] = 0;
+            continue;
+        }
 
-            // go to next dungeon than previously (one dungeon updated in one LFGMgr::UpdateRaidBrowser)
-            if (dungeonId <= m_raidBrowserLastUpdatedDungeonId[team])
-                continue;
-            m_raidBrowserLastUpdatedDungeonId[team] = dungeonId;
+        uint32 dungeonId = *itr;
+        m_raidBrowserLastUpdatedDungeonId[team] = dungeonId;
+        RBUpdateDungeon(team, dungeonId);
 
-            RBEntryInfoMap& entryInfoMap = RaidBrowserStore[team][dungeonId];
-            LFGDungeonData const* dungeonData = GetLFGDungeon(dungeonId); // checked if exists before inserting to the container
-            RBInternalInfoMap& currInternalInfoMap = RBInternalInfoStoreCurr[team][dungeonId];
-            for (RBEntryInfoMap::const_iterator sitr = entryInfoMap.begin(); sitr != entryInfoMap.end(); ++sitr)
-            {
-                guid = MAKE_NEW_GUID(sitr->first, 0, HIGHGUID_PLAYER);
-                groupGuid = 0;
-                Player* p = ObjectAccessor::FindPlayerInOrOutOfWorld(guid);
-                ASSERT(p);
-                if (sitr->second.roles == PLAYER_ROLE_LEADER)
-                {
-                    ASSERT(p->GetGroup());
-                    groupGuid = p->GetGroup()->GetGUID();
-                }
-                encounterMask = 0;
-                instanceGuid = 0;
-                if (InstancePlayerBind* bind = sInstanceSaveMgr->PlayerGetBoundInstance(sitr->first, dungeonData->map, dungeonData->difficulty))
-                    if (bind->perm)
-                    {
-                        instanceGuid = MAKE_NEW_GUID(bind->save->GetInstanceId(), 0, HIGHGUID_INSTANCE);
-                        encounterMask = bind->save->GetCompletedEncounterMask();
-                    }
+        // already updated all in this time interval
+        if (RBUsedDungeonsStore[team].upper_bound(dungeonId) == RBUsedDungeonsStore[team].end())
+            m_raidBrowserLastUpdatedDungeonId[team] = 0;
+    }
+}
 
-                talents[0] = 0;
-                talents[1] = 0;
-                talents[2] = 0;
-                p->GetTalentTreePoints(talents);
-                spellDamage = p->SpellBaseDamageBonusDone(SPELL_SCHOOL_MASK_ALL);
-                spellHeal = p->SpellBaseHealingBonusDone(SPELL_SCHOOL_MASK_ALL);
-                mp5 = p->GetFloatValue(UNIT_FIELD_POWER_REGEN_FLAT_MODIFIER);
-                mp5combat = p->GetFloatValue(UNIT_FIELD_POWER_REGEN_INTERRUPTED_FLAT_MODIFIER);
-                baseAP = p->GetTotalAttackPowerValue(BASE_ATTACK);
-                rangedAP = p->GetTotalAttackPowerValue(RANGED_ATTACK);
-                maxPower = 0;
-                if (p->getClass() == CLASS_DRUID)
-                    maxPower = p->GetMaxPower(POWER_MANA);
-                else
-                    maxPower = (p->getPowerType() == POWER_RAGE || p->getPowerType() == POWER_RUNIC_POWER) ? p->GetMaxPower(p->getPowerType())/10 : p->GetMaxPower(p->getPowerType());
-
-                currInternalInfoMap[sitr->first] = RBInternalInfo(guid, sitr->second.comment, groupGuid != 0, groupGuid, sitr->second.roles, encounterMask, instanceGuid,
-                    1, p->getLevel(), p->getClass(), p->getRace(), p->GetAverageItemLevel(), 
-                    talents, p->m_last_area_id, p->GetArmor(), (uint32)std::max<int32>(0, spellDamage), (uint32)std::max<int32>(0, spellHeal),
-                    p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_CRIT_MELEE), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_CRIT_RANGED), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_CRIT_SPELL), std::max<float>(0.0f, mp5), std::max<float>(0.0f, mp5combat),
-                    std::max<uint32>(baseAP, rangedAP), (uint32)p->GetStat(STAT_AGILITY), p->GetMaxHealth(), maxPower, p->GetDefenseSkillValue(),
-                    p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_DODGE), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_BLOCK), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_PARRY), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_HASTE_SPELL), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_EXPERTISE));
-
-                if (!groupGuid)
-                    continue;
-                for (Group::member_citerator mitr = p->GetGroup()->GetMemberSlots().begin(); mitr != p->GetGroup()->GetMemberSlots().end(); ++mitr)
-                {
-                    if (mitr->guid == sitr->first) // leader already added
-                        continue;
-                    guid = MAKE_NEW_GUID(mitr->guid, 0, HIGHGUID_PLAYER);
-                    level = 1;
-                    Class = 0;
-                    race = 0;
-                    iLevel = 0.0f;
-                    talents[0] = 0;
-                    talents[1] = 0;
-                    talents[2] = 0;
-                    if (const GlobalPlayerData* gpd = sWorld->GetGlobalPlayerData(mitr->guid))
-                    {
-                        level = gpd->level;
-                        Class = gpd->playerClass;
-                        race = gpd->race;
-                    }
-                    Player* mplr = ObjectAccessor::FindPlayerInOrOutOfWorld(guid);
-                    if (mplr)
-                    {
-                        iLevel = mplr->GetAverageItemLevel();
-                        mplr->GetTalentTreePoints(talents);
-                    }
-                    currInternalInfoMap[mitr->guid] = RBInternalInfo(guid, emptyComment, false, groupGuid, 0, 0, 0,
-                        (mplr ? 1 : 0), level, Class, race, iLevel, 
-                        talents, 0, 0, 0, 0,
-                        0, 0, 0, 0, 0,
-                        0, 0, 0, 0, 0,
-                        0, 0, 0, 0, 0);
-                }
+RBInternalInfo const& LFGMgr::RBGetPlayerInfo(uint8 team, Player* p)
+{
+    RBInternalInfoMap::const_iterator itr = RBStatsCacheStore[team].find(p->GetGUIDLow());
+    if (itr != RBStatsCacheStore[team].end())
+        return itr->second;
+
+    uint8 talents[3] = { 0, 0, 0 };
+    p->GetTalentTreePoints(talents);
+    int32 spellDamage = p->SpellBaseDamageBonusDone(SPELL_SCHOOL_MASK_ALL);
+    int32 spellHeal = p->SpellBaseHealingBonusDone(SPELL_SCHOOL_MASK_ALL);
+    float mp5 = p->GetFloatValue(UNIT_FIELD_POWER_REGEN_FLAT_MODIFIER);
+    float mp5combat = p->GetFloatValue(UNIT_FIELD_POWER_REGEN_INTERRUPTED_FLAT_MODIFIER);
+    float baseAP = p->GetTotalAttackPowerValue(BASE_ATTACK);
+    float rangedAP = p->GetTotalAttackPowerValue(RANGED_ATTACK);
+    uint32 maxPower = 0;
+    if (p->getClass() == CLASS_DRUID)
+        maxPower = p->GetMaxPower(POWER_MANA);
+    else
+        maxPower = (p->getPowerType() == POWER_RAGE || p->getPowerType() == POWER_RUNIC_POWER) ? p->GetMaxPower(p->getPowerType())/10 : p->GetMaxPower(p->getPowerType());
+
+    RBInternalInfo& info = RBStatsCacheStore[team][p->GetGUIDLow()];
+    info = RBInternalInfo(p->GetGUID(), std::string(), false, 0, 0, 0, 0,
+        1, p->getLevel(), p->getClass(), p->getRace(), p->GetAverageItemLevel(),
+        talents, p->m_last_area_id, p->GetArmor(), (uint32)std::max<int32>(0, spellDamage), (uint32)std::max<int32>(0, spellHeal),
+        p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_CRIT_MELEE), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_CRIT_RANGED), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_CRIT_SPELL), std::max<float>(0.0f, mp5), std::max<float>(0.0f, mp5combat),
+        std::max<uint32>(baseAP, rangedAP), (uint32)p->GetStat(STAT_AGILITY), p->GetMaxHealth(), maxPower, p->GetDefenseSkillValue(),
+        p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_DODGE), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_BLOCK), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_PARRY), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_HASTE_SPELL), p->GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + CR_EXPERTISE));
+    return info;
+}
+
+void LFGMgr::RBUpdateDungeon(uint8 team, uint32 dungeonId)
+{
+    RBEntryInfoMap& entryInfoMap = RaidBrowserStore[team][dungeonId];
+    LFGDungeonData const* dungeonData = GetLFGDungeon(dungeonId); // checked if exists before inserting to the container
+    RBInternalInfoMap& currInternalInfoMap = RBInternalInfoStoreCurr[team][dungeonId];
+    for (RBEntryInfoMap::const_iterator sitr = entryInfoMap.begin(); sitr != entryInfoMap.end(); ++sitr)
+        RBBuildEntryInfo(team, dungeonData, sitr->first, sitr->second, currInternalInfoMap);
+
+    if (entryInfoMap.empty())
+        RBUsedDungeonsStore[team].erase(dungeonId);
+
+    // compare prev with curr to build difference packet
+    RBInternalInfoMap& prevInternalInfoMap = RBInternalInfoStorePrev[team][dungeonId];
+    WorldPacket differencePacket(SMSG_UPDATE_LFG_LIST, 1000);
+    bool changed = RBBuildDifference(differencePacket, dungeonId, prevInternalInfoMap, currInternalInfoMap);
+    if (changed)
+        prevInternalInfoMap.swap(currInternalInfoMap);
+    currInternalInfoMap.clear();
+
+    // full update also corrects group members left behind by single entry updates
+    RBGroupMembersMap& groupMembersMap = RBGroupMembersStore[team][dungeonId];
+    groupMembersMap.clear();
+    for (RBInternalInfoMap::const_iterator sitr = prevInternalInfoMap.begin(); sitr != prevInternalInfoMap.end(); ++sitr)
+        if (!sitr->second.isGroupLeader && sitr->second.groupGuid)
+            groupMembersMap[sitr->second.groupGuid].push_back(sitr->first);
+
+    // nothing changed, cached full packet and browsing players are up to date
+    if (!changed)
+        return;
+
+    RBCacheDirtyStore[team].insert(dungeonId);
+    RBSendDifference(team, dungeonId, differencePacket);
+}
+
+void LFGMgr::RBUpdateEntry(uint8 team, uint32 dungeonId, uint32 guidLow)
+{
+    RBInternalInfoMap prevInfoMap, currInfoMap;
+
+    // entry as it is listed now
+    RBStoreMap::const_iterator sitr = RaidBrowserStore[team].find(dungeonId);
+    bool noEntries = sitr == RaidBrowserStore[team].end() || sitr->second.empty();
+    if (!noEntries)
+    {
+        RBEntryInfoMap::const_iterator eitr = sitr->second.find(guidLow);
+        if (eitr != sitr->second.end())
+            RBBuildEntryInfo(team, GetLFGDungeon(dungeonId), guidLow, eitr->second, currInfoMap);
+    }
+
+    // entry as browsing players know it, skip it if it is only a member of another listed group
+    RBInternalInfoMap& storeInfoMap = RBInternalInfoStorePrev[team][dungeonId];
+    RBGroupMembersMap& groupMembersMap = RBGroupMembersStore[team][dungeonId];
+    RBInternalInfoMap::const_iterator iitr = storeInfoMap.find(guidLow);
+    if (iitr != storeInfoMap.end() && (iitr->second.isGroupLeader || !iitr->second.groupGuid))
+    {
+        prevInfoMap[guidLow] = iitr->second;
+        RBGroupMembersMap::iterator gitr;
+        if (iitr->second.isGroupLeader && (gitr = groupMembersMap.find(iitr->second.groupGuid)) != groupMembersMap.end())
+        {
+            for (std::vector<uint32>::const_iterator mitr = gitr->second.begin(); mitr != gitr->second.end(); ++mitr)
+            {
+                RBInternalInfoMap::const_iterator member = storeInfoMap.find(*mitr);
+                if (member != storeInfoMap.end() && !member->second.isGroupLeader && member->second.groupGuid == gitr->first)
+                    prevInfoMap[*mitr] = member->second;
             }
+            groupMembersMap.erase(gitr);
+        }
+    }
 
-            copy.clear();
-            copy = currInternalInfoMap; // will be saved as prev at the end
+    WorldPacket differencePacket(SMSG_UPDATE_LFG_LIST, 1000);
+    bool changed = RBBuildDifference(differencePacket, dungeonId, prevInfoMap, currInfoMap);
 
-            // compare prev with curr to build difference packet
-            deletedCounter = 0; groupCounter = 0; playerCounter = 0;
-            buffer_deleted.clear(); buffer_groups.clear(); buffer_players.clear();
-            deletedGroups.clear(); deletedGroupsToErase.clear();
+    // replace the entry and its group members, the rest of the list is left untouched
+    for (RBInternalInfoMap::const_iterator itr = prevInfoMap.begin(); itr != prevInfoMap.end(); ++itr)
+        storeInfoMap.erase(itr->first);
+    for (RBInternalInfoMap::const_iterator itr = currInfoMap.begin(); itr != currInfoMap.end(); ++itr)
+    {
+        storeInfoMap[itr->first] = itr->second;
+        if (!itr->second.isGroupLeader && itr->second.groupGuid)
+            groupMembersMap[itr->second.groupGuid].push_back(itr->first);
+    }
 
-            RBInternalInfoMap& prevInternalInfoMap = RBInternalInfoStorePrev[team][dungeonId];
-            RBInternalInfoMap::iterator iter, iterTmp;
-            for (RBInternalInfoMap::const_iterator sitr = prevInternalInfoMap.begin(); sitr != prevInternalInfoMap.end(); ++sitr)
+    // keep the dungeon for the periodic update while anything is left to remove
+    if (noEntries && storeInfoMap.empty())
+        RBUsedDungeonsStore[team].erase(dungeonId);
+
+    if (!changed)
+        return;
+
+    RBCacheDirtyStore[team].insert(dungeonId);
+    RBSendDifference(team, dungeonId, differencePacket);
+}
+
+void LFGMgr::RBBuildEntryInfo(uint8 team, LFGDungeonData const* dungeonData, uint32 guidLow, RBEntryInfo const& entry, RBInternalInfoMap& infoMap)
+{
+    uint64 guid = MAKE_NEW_GUID(guidLow, 0, HIGHGUID_PLAYER);
+    uint64 groupGuid = 0;
+    Player* p = ObjectAccessor::FindPlayerInOrOutOfWorld(guid);
+    ASSERT(p);
+    if (entry.roles == PLAYER_ROLE_LEADER)
+    {
+        ASSERT(p->GetGroup());
+        groupGuid = p->GetGroup()->GetGUID();
+    }
+    uint32 encounterMask = 0;
+    uint64 instanceGuid = 0;
+    if (InstancePlayerBind* bind = sInstanceSaveMgr->PlayerGetBoundInstance(guidLow, dungeonData->map, dungeonData->difficulty))
+        if (bind->perm)
+        {
+            instanceGuid = MAKE_NEW_GUID(bind->save->GetInstanceId(), 0, HIGHGUID_INSTANCE);
+            encounterMask = bind->save->GetCompletedEncounterMask();
+        }
+
+    RBInternalInfo& info = infoMap[guidLow];
+    info = RBGetPlayerInfo(team, p);
+    info.comment = entry.comment;
+    info.isGroupLeader = groupGuid != 0;
+    info.groupGuid = groupGuid;
+    info.roles = entry.roles;
+    info.encounterMask = encounterMask;
+    info.instanceGuid = instanceGuid;
+
+    if (!groupGuid)
+        return;
+
+    uint8 level, Class, race, talents[3];
+    float iLevel;
+    std::string emptyComment;
+    for (Group::member_citerator mitr = p->GetGroup()->GetMemberSlots().begin(); mitr != p->GetGroup()->GetMemberSlots().end(); ++mitr)
+    {
+        if (mitr->guid == guidLow) // leader already added
+            continue;
+        guid = MAKE_NEW_GUID(mitr->guid, 0, HIGHGUID_PLAYER);
+        level = 1;
+        Class = 0;
+        race = 0;
+        iLevel = 0.0f;
+        talents[0] = 0;
+        talents[1] = 0;
+        talents[2] = 0;
+        if (const GlobalPlayerData* gpd = sWorld->GetGlobalPlayerData(mitr->guid))
+        {
+            level = gpd->level;
+            Class = gpd->playerClass;
+            race = gpd->race;
+        }
+        Player* mplr = ObjectAccessor::FindPlayerInOrOutOfWorld(guid);
+        if (mplr)
+        {
+            iLevel = mplr->GetAverageItemLevel();
+            mplr->GetTalentTreePoints(talents);
+        }
+        infoMap[mitr->guid] = RBInternalInfo(guid, emptyComment, false, groupGuid, 0, 0, 0,
+            (mplr ? 1 : 0), level, Class, race, iLevel, 
+            talents, 0, 0, 0, 0,
+            0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0);
+    }
+}
+
+bool LFGMgr::RBBuildDifference(WorldPacket& differencePacket, uint32 dungeonId, RBInternalInfoMap const& prevInfoMap, RBInternalInfoMap& currInfoMap)
+{
+    uint32 deletedCounter = 0, groupCounter = 0, playerCounter = 0;
+    ByteBuffer buffer_deleted, buffer_groups, buffer_players;
+    std::set<uint64> deletedGroups, deletedGroupsToErase;
+
+    RBInternalInfoMap::iterator iter;
+    for (RBInternalInfoMap::const_iterator sitr = prevInfoMap.begin(); sitr != prevInfoMap.end(); ++sitr)
+    {
+        iter = currInfoMap.find(sitr->first);
+        if (iter == currInfoMap.end()) // was -> isn't
+        {
+            if (sitr->second.isGroupLeader)
+                deletedGroups.insert(sitr->second.groupGuid);
+            ++deletedCounter;
+            buffer_deleted << (uint64)sitr->second.guid;
+        }
+        else // was -> is
+        {
+            if (sitr->second.isGroupLeader) // was a leader
             {
-                iter = currInternalInfoMap.find(sitr->first);
-                if (iter == currInternalInfoMap.end()) // was -> isn't
+                if (!iter->second.isGroupLeader) // leader -> no longer a leader
+                    deletedGroups.insert(sitr->second.groupGuid);
+                else if (sitr->second.groupGuid != iter->second.groupGuid) // leader -> leader of another group
                 {
-                    if (sitr->second.isGroupLeader)
-                        deletedGroups.insert(sitr->second.groupGuid);
-                    ++deletedCounter;
-                    buffer_deleted << (uint64)sitr->second.guid;
+                    deletedGroups.insert(sitr->second.groupGuid);
+                    deletedGroupsToErase.insert(iter->second.groupGuid);
+                    ++groupCounter;
+                    RBPacketAppendGroup(iter->second, buffer_groups);
                 }
-                else // was -> is
+                else if (sitr->second.comment != iter->second.comment || sitr->second.encounterMask != iter->second.encounterMask || sitr->second.instanceGuid != iter->second.instanceGuid) // leader -> nothing changed
                 {
-                    if (sitr->second.isGroupLeader) // was a leader
-                    {
-                        if (!iter->second.isGroupLeader) // leader -> no longer a leader
-                            deletedGroups.insert(sitr->second.groupGuid);
-                        else if (sitr->second.groupGuid != iter->second.groupGuid) // leader -> leader of another group
-                        {
-                            deletedGroups.insert(sitr->second.groupGuid);
-                            deletedGroupsToErase.insert(iter->second.groupGuid);
-                            ++groupCounter;
-                            RBPacketAppendGroup(iter->second, buffer_groups);
-                        }
-                        else if (sitr->second.comment != iter->second.comment || sitr->second.encounterMask != iter->second.encounterMask || sitr->second.instanceGuid != iter->second.instanceGuid) // leader -> nothing changed
-                        {
-                            ++groupCounter;
-                            RBPacketAppendGroup(iter->second, buffer_groups);
-                        }
-                    }
-                    else if (iter->second.isGroupLeader) // wasn't a leader -> is a leader
-                    {
-                        deletedGroupsToErase.insert(iter->second.groupGuid);
-                        ++groupCounter;
-                        RBPacketAppendGroup(iter->second, buffer_groups);
-                    }
-
-                    if (!iter->second._online) // if offline, copy previous stats (itemLevel, talents, area, etc.)
-                    {
-                        iterTmp = copy.find(sitr->first); // copied container is for building a full packet, so modify it there (currInternalInfoMap is erased)
-                        iterTmp->second.CopyStats(sitr->second);
-                        if (!sitr->second.PlayerSameAs(iterTmp->second)) // player info changed
-                        {
-                            ++playerCounter;
-                            RBPacketAppendPlayer(iterTmp->second, buffer_players);
-                        }
-                    }
-                    else if (!sitr->second.PlayerSameAs(iter->second)) // player info changed
-                    {
-                        ++playerCounter;
-                        RBPacketAppendPlayer(iter->second, buffer_players);
-                    }
-                    currInternalInfoMap.erase(iter);
+                    ++groupCounter;
+                    RBPacketAppendGroup(iter->second, buffer_groups);
                 }
             }
-            // left entries (new)
-            for (RBInternalInfoMap::const_iterator sitr = currInternalInfoMap.begin(); sitr != currInternalInfoMap.end(); ++sitr)
+            else if (iter->second.isGroupLeader) // wasn't a leader -> is a leader
             {
-                if (sitr->second.isGroupLeader)
-                {
-                    deletedGroupsToErase.insert(sitr->second.groupGuid);
-                    ++groupCounter;
-                    RBPacketAppendGroup(sitr->second, buffer_groups);
-                }
-                ++playerCounter;
-                RBPacketAppendPlayer(sitr->second, buffer_players);
+                deletedGroupsToErase.insert(iter->second.groupGuid);
+                ++groupCounter;
+                RBPacketAppendGroup(iter->second, buffer_groups);
             }
 
-            if (!deletedGroupsToErase.empty())
-                for (std::set<uint64>::const_iterator sitr = deletedGroupsToErase.begin(); sitr != deletedGroupsToErase.end(); ++sitr)
-                    deletedGroups.erase(*sitr);
-
-            if (!deletedGroups.empty())
-                for (std::set<uint64>::const_iterator sitr = deletedGroups.begin(); sitr != deletedGroups.end(); ++sitr)
-                {
-                    ++deletedCounter;
-                    buffer_deleted << (*sitr);
-                }
-
-            WorldPacket differencePacket(SMSG_UPDATE_LFG_LIST, 1000);
-            RBPacketBuildDifference(differencePacket, dungeonId, deletedCounter, buffer_deleted, groupCounter, buffer_groups, playerCounter, buffer_players);
-            WorldPacket fullPacket(SMSG_UPDATE_LFG_LIST, 1000);
-            RBPacketBuildFull(fullPacket, dungeonId, copy);
+            if (!iter->second._online) // if offline, copy previous stats (itemLevel, talents, area, etc.)
+                iter->second.CopyStats(sitr->second);
+            if (!sitr->second.PlayerSameAs(iter->second)) // player info changed
+            {
+                ++playerCounter;
+                RBPacketAppendPlayer(iter->second, buffer_players);
+            }
+        }
+    }
+    // entries not known before (new)
+    for (RBInternalInfoMap::const_iterator sitr = currInfoMap.begin(); sitr != currInfoMap.end(); ++sitr)
+    {
+        if (prevInfoMap.find(sitr->first) != prevInfoMap.end())
+            continue;
+        if (sitr->second.isGroupLeader)
+        {
+            deletedGroupsToErase.insert(sitr->second.groupGuid);
+            ++groupCounter;
+            RBPacketAppendGroup(sitr->second, buffer_groups);
+        }
+        ++playerCounter;
+        RBPacketAppendPlayer(sitr->second, buffer_players);
+    }
 
-            RBCacheStore[team][dungeonId] = fullPacket;
-            prevInternalInfoMap = copy;
-            currInternalInfoMap.clear();
+    if (!deletedGroupsToErase.empty())
+        for (std::set<uint64>::const_iterator sitr = deletedGroupsToErase.begin(); sitr != deletedGroupsToErase.end(); ++sitr)
+            deletedGroups.erase(*sitr);
 
-            if (entryInfoMap.empty())
-                RBUsedDungeonsStore[team].erase(titr);
+    if (!deletedGroups.empty())
+        for (std::set<uint64>::const_iterator sitr = deletedGroups.begin(); sitr != deletedGroups.end(); ++sitr)
+        {
+            ++deletedCounter;
+            buffer_deleted << (*sitr);
+        }
 
-            // send difference packet to browsing players
-            for (RBSearchersMap::const_iterator sitr = RBSearchersStore[team].begin(); sitr != RBSearchersStore[team].end(); ++sitr)
-                if (sitr->second == dungeonId)
-                    if (Player* p = ObjectAccessor::FindPlayerInOrOutOfWorld(MAKE_NEW_GUID(sitr->first, 0, HIGHGUID_PLAYER)))
-                        p->GetSession()->SendPacket(&differencePacket);
+    if (!deletedCounter && !groupCounter && !playerCounter)
+        return false;
 
-            break; // one dungeon updated in one LFGMgr::UpdateRaidBrowser
-        }
+    RBPacketBuildDifference(differencePacket, dungeonId, deletedCounter, buffer_deleted, groupCounter, buffer_groups, playerCounter, buffer_players);
+    return true;
+}
 
-        // already updated all in this time interval
-        if (neitr == RBUsedDungeonsStore[team].end())
-            m_raidBrowserLastUpdatedDungeonId[team] = 0;
-    }
+void LFGMgr::RBSendDifference(uint8 team, uint32 dungeonId, WorldPacket& differencePacket)
+{
+    // send difference packet to browsing players
+    for (RBSearchersMap::const_iterator sitr = RBSearchersStore[team].begin(); sitr != RBSearchersStore[team].end(); ++sitr)
+        if (sitr->second == dungeonId)
+            if (Player* p = ObjectAccessor::FindPlayerInOrOutOfWorld(MAKE_NEW_GUID(sitr->first, 0, HIGHGUID_PLAYER)))
+                p->GetSession()->SendPacket(&differencePacket);
 }
 
 void LFGMgr::RBPacketAppendGroup(const RBInternalInfo& info, ByteBuffer& buffer)
@@ -2322,7 +2444,10 @@ void LFGMgr::LfrSetComment(Player* p, std::string comment)
     RBEntryInfoMap::iterator iter;
     for (RBStoreMap::iterator itr = RaidBrowserStore[teamId].begin(); itr != RaidBrowserStore[teamId].end(); ++itr)
         if ((iter = itr->second.find(p->GetGUIDLow())) != itr->second.end())
+        {
             iter->second.comment = comment;
+            RBChangedEntriesStore[teamId].insert(std::make_pair(itr->first, p->GetGUIDLow()));
+        }
 }
 
 void LFGMgr::SetSelectedDungeons(uint64 guid, LfgDungeonSet const& dungeons)
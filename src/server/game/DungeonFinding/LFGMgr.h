@@ -399,6 +399,13 @@ class LFGMgr
         RBInternalInfoMapMap RBInternalInfoStoreCurr[2]; // for 2 factions
         typedef std::set<uint32 /*dungeonId*/> RBUsedDungeonsSet; // needs to be ordered
         RBUsedDungeonsSet RBUsedDungeonsStore[2]; // for 2 factions
+        RBUsedDungeonsSet RBCacheDirtyStore[2]; // for 2 factions, dungeons whose cached full packet is rebuilt on next request
+        typedef std::unordered_map<uint64 /*groupGuid*/, std::vector<uint32 /*memberGuidLow*/> > RBGroupMembersMap;
+        typedef std::unordered_map<uint32 /*dungeonId*/, RBGroupMembersMap> RBGroupMembersMapMap;
+        RBGroupMembersMapMap RBGroupMembersStore[2]; // for 2 factions, members of listed groups in RBInternalInfoStorePrev
+        typedef std::set<std::pair<uint32 /*dungeonId*/, uint32 /*playerGuidLow*/> > RBChangedEntriesSet;
+        RBChangedEntriesSet RBChangedEntriesStore[2]; // for 2 factions, entries to update without waiting for the periodic update
+        RBInternalInfoMap RBStatsCacheStore[2]; // for 2 factions, stats of listed players, cleared periodically
 
     public:
         // Functions used outside lfg namespace
@@ -510,6 +517,12 @@ class LFGMgr
         void LfrSearchRemove(Player* p);
         void SendRaidBrowserCachedList(Player* player, uint32 dungeonId);
         void UpdateRaidBrowser(uint32 diff);
+        void RBUpdateDungeon(uint8 team, uint32 dungeonId);
+        void RBUpdateEntry(uint8 team, uint32 dungeonId, uint32 guidLow);
+        void RBBuildEntryInfo(uint8 team, LFGDungeonData const* dungeonData, uint32 guidLow, RBEntryInfo const& entry, RBInternalInfoMap& infoMap);
+        bool RBBuildDifference(WorldPacket& differencePacket, uint32 dungeonId, RBInternalInfoMap const& prevInfoMap, RBInternalInfoMap& currInfoMap);
+        void RBSendDifference(uint8 team, uint32 dungeonId, WorldPacket& differencePacket);
+        RBInternalInfo const& RBGetPlayerInfo(uint8 team, Player* p);
         void LfrSetComment(Player* p, std::string comment);
         void SendRaidBrowserJoinedPacket(Player* p, LfgDungeonSet& dungeons, std::string comment);
         void RBPacketAppendGroup(const RBInternalInfo& info, ByteBuffer& buffer);
@@ -574,6 +587,7 @@ class LFGMgr
         uint32 lastProposalId;                             ///< pussywizard, store it here because of splitting LFGMgr update into tasks
         uint32 m_raidBrowserUpdateTimer[2];                ///< pussywizard
         uint32 m_raidBrowserLastUpdatedDungeonId[2];       ///< pussywizard: for 2 factions
+        uint32 m_raidBrowserStatsCacheTimer[2];            ///< for 2 factions, independent of the periodic update
 
         LfgQueueContainer QueuesStore;                     ///< Queues
         LfgCachedDungeonContainer CachedDungeonMapStore;   ///< Stores all dungeons by groupType
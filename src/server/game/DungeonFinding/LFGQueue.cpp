@@ -29,6 +29,67 @@
 namespace lfg
 {
 
+namespace
+{
+    // for every combination of roles: the role counters (LfgQueueData::roleCounts) of players who can only
+    // take roles from that combination, and the number of players the combination has slots for
+    struct LfgRoleSlotTable
+    {
+        LfgRoleSlotTable()
+        {
+            for (uint8 roles = 0; roles < 8; ++roles)
+            {
+                Counters[roles] = 0;
+                for (uint8 mask = 1; mask < 8; ++mask)
+                    if ((mask & roles) == mask)
+                        Counters[roles] |= 0xFu << (4 * mask);
+
+                Slots[roles] = ((roles & (PLAYER_ROLE_TANK >> 1)) ? LFG_TANKS_NEEDED : 0) +
+                    ((roles & (PLAYER_ROLE_HEALER >> 1)) ? LFG_HEALERS_NEEDED : 0) +
+                    ((roles & (PLAYER_ROLE_DAMAGE >> 1)) ? LFG_DPS_NEEDED : 0);
+            }
+        }
+
+        uint32 Counters[8];
+        uint8 Slots[8];
+    };
+
+    LfgRoleSlotTable const RoleSlots;
+
+    // sum of all 4 bit counters, valid while the sum stays below 16
+    inline uint32 SumRoleCounters(uint32 roleCounts)
+    {
+        return (roleCounts * 0x11111111u) >> 28;
+    }
+
+    // roles can be assigned if, for every combination of roles, the players limited to it fit its slots
+    // this gives the same answer as LFGMgr::CheckGroupRoles without assigning the roles
+    bool HasRoleAssignment(uint32 roleCounts)
+    {
+        // a player without any role
+        if (roleCounts & 0xF)
+            return false;
+
+        for (uint8 roles = 1; roles < 8; ++roles)
+            if (SumRoleCounters(roleCounts & RoleSlots.Counters[roles]) > RoleSlots.Slots[roles])
+                return false;
+
+        return true;
+    }
+}
+
+LfgQueueData::LfgQueueData(time_t _joinTime, LfgDungeonSet const& _dungeons, LfgRolesMap const& _roles):
+    joinTime(_joinTime), lastRefreshTime(_joinTime), tanks(LFG_TANKS_NEEDED), healers(LFG_HEALERS_NEEDED),
+    dps(LFG_DPS_NEEDED), dungeons(_dungeons), roles(_roles), roleCounts(0)
+{
+    for (LfgDungeonSet::const_iterator itr = dungeons.begin(); itr != dungeons.end(); ++itr)
+        if (*itr < LFG_DUNGEON_MASK_SIZE)
+            dungeonMask.set(*itr);
+
+    for (LfgRolesMap::const_iterator itr = roles.begin(); itr != roles.end(); ++itr)
+        roleCounts += 1 << (4 * ((itr->second & ~PLAYER_ROLE_LEADER) >> 1));
+}
+
 void LFGQueue::AddToQueue(uint64 guid, bool failedProposal)
 {
     //sLog->outString("ADD AddToQueue: %u, failed proposal: %u", GUID_LOPART(guid), failedProposal ? 1 : 0);
@@ -162,10 +223,10 @@ void LFGQueue::RemoveFromCompatibles(uint64 guid)
     }
 }
 
-void LFGQueue::AddToCompatibles(Lfg5Guids const& key)
+void LFGQueue::AddToCompatibles(Lfg5Guids const& key, LfgDungeonMask const& dungeons, uint32 roleCounts)
 {
     //sLog->outString("COMPATIBLES ADD: %s", key.toString().c_str());
-    CompatibleTempList.push_back(key);
+    CompatibleTempList.push_back(LfgCompatible(key, dungeons, roleCounts));
 }
 
 uint8 LFGQueue::FindGroups()
@@ -202,7 +263,7 @@ LfgCompatibility LFGQueue::FindNewGroups(const uint64& newGuid)
     // we have to take into account that FindNewGroups is called every X minutes if number of compatibles is low!
     // build set of already present compatibles for this guid
     std::set<Lfg5Guids> currentCompatibles;
-    for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
+    for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
         if (it->hasGuid(newGuid))
         {
             // unset roles here so they are not copied, restore after insertion
@@ -220,15 +281,21 @@ LfgCompatibility LFGQueue::FindNewGroups(const uint64& newGuid)
             return selfCompatibility;
     }
 
-    for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
+    LfgQueueDataContainer::const_iterator itNew = QueueDataStore.find(newGuid);
+    for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
     {
-        Lfg5GuidsList::iterator itr = it++;
+        LfgCompatibleContainer::iterator itr = it++;
         if (itr->empty())
         {
             //sLog->outString("ERASE from CompatibleList");
             CompatibleList.erase(itr);
             continue;
         }
+
+        // no common dungeon or no possible role assignment, skip without looking up every member
+        if (itNew != QueueDataStore.end() && ((itr->dungeonMask & itNew->second.dungeonMask).none() || !HasRoleAssignment(itr->roleCounts + itNew->second.roleCounts)))
+            continue;
+
         LfgCompatibility compatibility = CheckCompatibility(*itr, newGuid, foundMask, foundCount, currentCompatibles);
         if (compatibility == LFG_COMPATIBLES_MATCH)
             return LFG_COMPATIBLES_MATCH;
@@ -251,7 +318,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const
         return LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS;
 
     LfgProposal proposal;
-    LfgDungeonSet proposalDungeons;
+    LfgDungeonMask proposalDungeons;
     LfgGroupsMap proposalGroups;
     LfgRolesMap proposalRoles;
 
@@ -260,6 +327,8 @@ LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const
     uint8 numLfgGroups = 0;
     uint64 guid;
     uint64 addToFoundMask = 0;
+    uint32 roleCounts = 0;
+    proposalDungeons.set();
 
     for (uint8 i=0; i<5 && (guid=check.guid[i]) != 0 && numLfgGroups < 2 && numPlayers <= MAXGROUPSIZE; ++i)
     {
@@ -276,6 +345,8 @@ LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const
             proposalGroups[it2->first] = IS_GROUP_GUID(itQueue->first) ? itQueue->first : 0;
 
         numPlayers += itQueue->second.roles.size();
+        roleCounts += itQueue->second.roleCounts;
+        proposalDungeons &= itQueue->second.dungeonMask;
 
         if (sLFGMgr->IsLfgGroup(guid))
         {
@@ -297,7 +368,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const
         strGuids.addRoles(roles);
         itQueue->second.bestCompatible.clear(); // this may be left after a failed proposal (not cleared, because UpdateQueueTimers would try to generate it with every update)
         //UpdateBestCompatibleInQueue(itQueue, strGuids);
-        AddToCompatibles(strGuids);
+        AddToCompatibles(strGuids, proposalDungeons, roleCounts);
         if (roleCheckResult && roleCheckResult <= 15)
             foundMask |= ( (((uint64)1)<<(roleCheckResult-1)) | (((uint64)1)<<(16+roleCheckResult-1)) | (((uint64)1)<<(32+roleCheckResult-1)) | (((uint64)1)<<(48+roleCheckResult-1)) );
         return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
@@ -309,6 +380,13 @@ LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const
     // If it's single group no need to check for duplicate players, ignores, bad roles or bad dungeons as it's been checked before joining
     if (check.size() > 1)
     {
+        // bitset and role counter checks first, they are much cheaper than the per player checks below
+        if (proposalDungeons.none())
+            return LFG_INCOMPATIBLES_NO_DUNGEONS;
+
+        if (!HasRoleAssignment(roleCounts))
+            return LFG_INCOMPATIBLES_NO_ROLES;
+
         for (uint8 i=0; i<5 && check.guid[i]; ++i)
         {
             const LfgRolesMap &roles = QueueDataStore[check.guid[i]].roles;
@@ -363,24 +441,11 @@ LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const
         }
         else
             addToFoundMask |= (((uint64)1)<<(roleCheckResult-1));
-
-        proposalDungeons = QueueDataStore[check.front()].dungeons;
-        for (uint8 i=1; i<5 && check.guid[i]; ++i)
-        {
-            LfgDungeonSet temporal;
-            LfgDungeonSet &dungeons = QueueDataStore[check.guid[i]].dungeons;
-            std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
-            proposalDungeons = temporal;
-        }
-
-        if (proposalDungeons.empty())
-            return LFG_INCOMPATIBLES_NO_DUNGEONS;
     }
     else
     {
         uint64 gguid = check.front();
         const LfgQueueData &queue = QueueDataStore[gguid];
-        proposalDungeons = queue.dungeons;
         proposalRoles = queue.roles;
         LFGMgr::CheckGroupRoles(proposalRoles);          // assing new roles
     }
@@ -395,7 +460,7 @@ LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const
             if (!itr->second.bestCompatible.empty()) // update if groups don't have it empty (for empty it will be generated in UpdateQueueTimers)
                 UpdateBestCompatibleInQueue(itr, strGuids);
         }
-        AddToCompatibles(strGuids);
+        AddToCompatibles(strGuids, proposalDungeons, roleCounts);
         foundMask |= addToFoundMask;
         ++foundCount;
         return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
@@ -412,7 +477,14 @@ LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const
     proposal.cancelTime = time(NULL) + LFG_TIME_PROPOSAL;
     proposal.state = LFG_PROPOSAL_INITIATING;
     proposal.leader = 0;
-    proposal.dungeonId = Trinity::Containers::SelectRandomContainerElement(proposalDungeons);
+
+    // every member selected the dungeons of the first one which are still in the mask
+    std::vector<uint32> dungeons;
+    LfgDungeonSet const& frontDungeons = QueueDataStore[gguid].dungeons;
+    for (LfgDungeonSet::const_iterator itr = frontDungeons.begin(); itr != frontDungeons.end(); ++itr)
+        if (*itr < LFG_DUNGEON_MASK_SIZE && proposalDungeons.test(*itr))
+            dungeons.push_back(*itr);
+    proposal.dungeonId = Trinity::Containers::SelectRandomContainerElement(dungeons);
 
     bool leader = false;
     for (LfgRolesMap::const_iterator itRoles = proposalRoles.begin(); itRoles != proposalRoles.end(); ++itRoles)
@@ -457,9 +529,9 @@ void LFGQueue::UpdateQueueTimers(uint32 diff)
         m_QueueStatusTimer += diff;
 
     //sLog->outString("UPDATE UpdateQueueTimers");
-    for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
+    for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
     {
-        Lfg5GuidsList::iterator itr = it++;
+        LfgCompatibleContainer::iterator itr = it++;
         if (itr->empty())
         {
             //sLog->outString("UpdateQueueTimers ERASE compatible");
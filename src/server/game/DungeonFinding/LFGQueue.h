@@ -29,13 +29,10 @@ enum LfgCompatibility
 struct LfgQueueData
 {
     LfgQueueData(): joinTime(time_t(time(NULL))), lastRefreshTime(joinTime), tanks(LFG_TANKS_NEEDED),
-        healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED)
+        healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED), roleCounts(0)
         { }
 
-    LfgQueueData(time_t _joinTime, LfgDungeonSet const& _dungeons, LfgRolesMap const& _roles):
-        joinTime(_joinTime), lastRefreshTime(_joinTime), tanks(LFG_TANKS_NEEDED), healers(LFG_HEALERS_NEEDED),
-        dps(LFG_DPS_NEEDED), dungeons(_dungeons), roles(_roles)
-        { }
+    LfgQueueData(time_t _joinTime, LfgDungeonSet const& _dungeons, LfgRolesMap const& _roles);
 
     time_t joinTime;                                       ///< Player queue join time (to calculate wait times)
     time_t lastRefreshTime;                                ///< pussywizard
@@ -45,6 +42,20 @@ struct LfgQueueData
     LfgDungeonSet dungeons;                                ///< Selected Player/Group Dungeon/s
     LfgRolesMap roles;                                     ///< Selected Player Role/s
     Lfg5Guids bestCompatible;                              ///< Best compatible combination of people queued
+    LfgDungeonMask dungeonMask;                            ///< Selected dungeons as bitset
+    uint32 roleCounts;                                     ///< Number of players for each selectable role combination, 4 bits each
+};
+
+/// Compatible combination of queued groups, with the data to reject new candidates without looking up every member
+class LfgCompatible : public Lfg5Guids
+{
+public:
+    LfgCompatible(Lfg5Guids const& guids, LfgDungeonMask const& dungeons, uint32 roles): Lfg5Guids(guids),
+        dungeonMask(dungeons), roleCounts(roles)
+        { }
+
+    LfgDungeonMask dungeonMask;                            ///< Dungeons every member selected
+    uint32 roleCounts;                                     ///< Sum of the members' role counts
 };
 
 struct LfgWaitTime
@@ -56,7 +67,7 @@ struct LfgWaitTime
 
 typedef std::map<uint32, LfgWaitTime> LfgWaitTimesContainer;
 typedef std::map<uint64, LfgQueueData> LfgQueueDataContainer;
-typedef std::list<Lfg5Guids> LfgCompatibleContainer;
+typedef std::list<LfgCompatible> LfgCompatibleContainer;
 
 /**
     Stores all data related to queue
@@ -91,7 +102,7 @@ class LFGQueue
         void RemoveFromNewQueue(uint64 guid);
 
         void RemoveFromCompatibles(uint64 guid);
-        void AddToCompatibles(Lfg5Guids const& key);
+        void AddToCompatibles(Lfg5Guids const& key, LfgDungeonMask const& dungeons, uint32 roleCounts);
 
         uint32 FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue);
         void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, Lfg5Guids const& key);
@@ -163,7 +163,7 @@ Creature::Creature(bool isWorldObject): Unit(isWorldObject), MovableMapObject(),
 m_corpseRemoveTime(0), m_respawnTime(0), m_respawnDelay(300), m_corpseDelay(60), m_respawnradius(0.0f),
 m_transportCheckTimer(1000), lootPickPocketRestoreTime(0),  m_reactState(REACT_AGGRESSIVE), m_defaultMovementType(IDLE_MOTION_TYPE),
 m_DBTableGuid(0), m_equipmentId(0), m_originalEquipmentId(0), m_AlreadyCallAssistance(false),
-m_AlreadySearchedAssistance(false), m_regenHealth(true), m_AI_locked(false), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL), m_originalEntry(0), m_moveInLineOfSightDisabled(false), m_moveInLineOfSightStrictlyDisabled(false),
+m_AlreadySearchedAssistance(false), m_regenHealth(true), m_AI_locked(false), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL), m_originalEntry(0), m_moveInLineOfSightDisabled(false), m_moveInLineOfSightStrictlyDisabled(false), m_defaultMoveInLineOfSight(false), m_postponedUpdateDiff(0),
 m_homePosition(), m_transportHomePosition(), m_creatureInfo(NULL), m_creatureData(NULL), m_waypointID(0), m_path_id(0), m_formation(NULL), _lastDamagedTime(0)
 {
     m_regenTimer = CREATURE_REGEN_INTERVAL;
@@ -485,6 +485,32 @@ bool Creature::UpdateEntry(uint32 Entry, const CreatureData* data, bool changele
     return true;
 }
 
+bool Creature::PrepareUpdate(uint32& diff, uint32 idleInterval)
+{
+    // back at full rate, time postponed in the idle cells is handed over with this update
+    if (!idleInterval)
+    {
+        diff += m_postponedUpdateDiff;
+        m_postponedUpdateDiff = 0;
+        return true;
+    }
+
+    m_postponedUpdateDiff += diff;
+    if (m_postponedUpdateDiff < idleInterval && CanPostponeUpdate())
+        return false;
+
+    diff = m_postponedUpdateDiff;
+    m_postponedUpdateDiff = 0;
+    return true;
+}
+
+bool Creature::CanPostponeUpdate() const
+{
+    // anything a player or a fight depends on keeps the full update rate
+    return !IsInCombat() && !isActiveObject() && !IsInEvadeMode() && !GetCharmerOrOwnerGUID() &&
+        !GetVehicleKit() && !GetVehicle() && !GetTransport();
+}
+
 void Creature::Update(uint32 diff)
 { 
     if (IsAIEnabled && TriggerJustRespawned)
@@ -1537,6 +1563,29 @@ bool Creature::CanStartAttack(Unit const* who) const
     return IsWithinLOSInMap(who);
 }
 
+// Mirrors the early outs of CreatureAI::MoveInLineOfSight and CanStartAttack, cheapest checks first.
+// Only valid for creatures with HasDefaultMoveInLineOfSight()
+bool Creature::IsMoveInLineOfSightCandidate(Unit const* who) const
+{
+    if (GetVictim() || IsCivilian())
+        return false;
+
+    if (!who->IsInCombat())
+    {
+        // no assistance possible, who has to enter our aggro radius
+        if (m_moveInLineOfSightDisabled || IsNeutralToAll())
+            return false;
+
+        if (!IsWithinDistInMap(who, GetAggroRange(who) + m_CombatDistance))
+            return false;
+    }
+
+    if (!CanFly() && (GetDistanceZ(who) > CREATURE_Z_ATTACK_RANGE + m_CombatDistance))
+        return false;
+
+    return !IsFriendlyTo(who);
+}
+
 void Creature::setDeathState(DeathState s, bool despawn)
 { 
     Unit::setDeathState(s, despawn);
@@ -1757,41 +1806,32 @@ SpellInfo const* Creature::reachWithSpellAttack(Unit* victim)
     {
         if (!m_spells[i])
             continue;
-        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(m_spells[i]);
-        if (!spellInfo)
+        uint32 spellId = m_spells[i];
+        SpellHotInfo const* hotInfo = sSpellMgr->GetSpellHotInfo(spellId);
+        if (!hotInfo)
         {
-            sLog->outError("WORLD: unknown spell id %i", m_spells[i]);
+            sLog->outError("WORLD: unknown spell id %i", spellId);
             continue;
         }
 
-        bool bcontinue = true;
-        for (uint32 j = 0; j < MAX_SPELL_EFFECTS; j++)
-        {
-            if ((spellInfo->Effects[j].Effect == SPELL_EFFECT_SCHOOL_DAMAGE)       ||
-                (spellInfo->Effects[j].Effect == SPELL_EFFECT_INSTAKILL)            ||
-                (spellInfo->Effects[j].Effect == SPELL_EFFECT_ENVIRONMENTAL_DAMAGE) ||
-                (spellInfo->Effects[j].Effect == SPELL_EFFECT_HEALTH_LEECH)
-                )
-            {
-                bcontinue = false;
-                break;
-            }
-        }
-        if (bcontinue)
+        if (!hotInfo->HasEffect(SPELL_EFFECT_SCHOOL_DAMAGE) &&
+            !hotInfo->HasEffect(SPELL_EFFECT_INSTAKILL) &&
+            !hotInfo->HasEffect(SPELL_EFFECT_ENVIRONMENTAL_DAMAGE) &&
+            !hotInfo->HasEffect(SPELL_EFFECT_HEALTH_LEECH))
             continue;
 
-        if (spellInfo->ManaCost > GetPower(POWER_MANA))
+        if (hotInfo->ManaCost > GetPower(POWER_MANA))
             continue;
-        float range = spellInfo->GetMaxRange(false);
-        float minrange = spellInfo->GetMinRange(false);
+        float range = hotInfo->GetMaxRange(false);
+        float minrange = hotInfo->GetMinRange(false);
         float dist = GetDistance(victim);
         if (dist > range || dist < minrange)
             continue;
-        if (spellInfo->PreventionType == SPELL_PREVENTION_TYPE_SILENCE && HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_SILENCED))
+        if (hotInfo->PreventionType == SPELL_PREVENTION_TYPE_SILENCE && HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_SILENCED))
             continue;
-        if (spellInfo->PreventionType == SPELL_PREVENTION_TYPE_PACIFY && HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_PACIFIED))
+        if (hotInfo->PreventionType == SPELL_PREVENTION_TYPE_PACIFY && HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_PACIFIED))
             continue;
-        return spellInfo;
+        return sSpellMgr->GetSpellInfo(spellId);
     }
     return NULL;
 }
@@ -1805,40 +1845,32 @@ SpellInfo const* Creature::reachWithSpellCure(Unit* victim)
     {
         if (!m_spells[i])
             continue;
-        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(m_spells[i]);
-        if (!spellInfo)
+        uint32 spellId = m_spells[i];
+        SpellHotInfo const* hotInfo = sSpellMgr->GetSpellHotInfo(spellId);
+        if (!hotInfo)
         {
-            sLog->outError("WORLD: unknown spell id %i", m_spells[i]);
+            sLog->outError("WORLD: unknown spell id %i", spellId);
             continue;
         }
 
-        bool bcontinue = true;
-        for (uint32 j = 0; j < MAX_SPELL_EFFECTS; j++)
-        {
-            if ((spellInfo->Effects[j].Effect == SPELL_EFFECT_HEAL))
-            {
-                bcontinue = false;
-                break;
-            }
-        }
-        if (bcontinue)
+        if (!hotInfo->HasEffect(SPELL_EFFECT_HEAL))
             continue;
 
-        if (spellInfo->ManaCost > GetPower(POWER_MANA))
+        if (hotInfo->ManaCost > GetPower(POWER_MANA))
             continue;
 
-        float range = spellInfo->GetMaxRange(true);
-        float minrange = spellInfo->GetMinRange(true);
+        float range = hotInfo->GetMaxRange(true);
+        float minrange = hotInfo->GetMinRange(true);
         float dist = GetDistance(victim);
         //if (!isInFront(victim, range) && spellInfo->AttributesEx)
         //    continue;
         if (dist > range || dist < minrange)
             continue;
-        if (spellInfo->PreventionType == SPELL_PREVENTION_TYPE_SILENCE && HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_SILENCED))
+        if (hotInfo->PreventionType == SPELL_PREVENTION_TYPE_SILENCE && HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_SILENCED))
             continue;
-        if (spellInfo->PreventionType == SPELL_PREVENTION_TYPE_PACIFY && HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_PACIFIED))
+        if (hotInfo->PreventionType == SPELL_PREVENTION_TYPE_PACIFY && HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_PACIFIED))
             continue;
-        return spellInfo;
+        return sSpellMgr->GetSpellInfo(spellId);
     }
     return NULL;
 }
@@ -2069,9 +2101,12 @@ void Creature::UpdateMoveInLineOfSightState()
     {
         m_moveInLineOfSightStrictlyDisabled = false;
         m_moveInLineOfSightDisabled = false;
+        m_defaultMoveInLineOfSight = false;
         return;
     }
 
+    m_defaultMoveInLineOfSight = true;
+
     if (IsTrigger() || IsCivilian() || GetCreatureType() == CREATURE_TYPE_NON_COMBAT_PET || IsCritter() || GetAIName() == "NullCreatureAI")
     {
         m_moveInLineOfSightDisabled = true;
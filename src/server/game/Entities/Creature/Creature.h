@@ -442,6 +442,10 @@ class Creature : public Unit, public GridObject<Creature>, public MovableMapObje
         uint32 GetDBTableGUIDLow() const { return m_DBTableGuid; }
 
         void Update(uint32 time) override;                         // overwrited Unit::Update
+        // Idle creatures are updated once per idleInterval with the time accumulated meanwhile,
+        // returns false while the update is postponed. diff is set to the full elapsed time.
+        bool PrepareUpdate(uint32& diff, uint32 idleInterval);
+        bool CanPostponeUpdate() const;
         void GetRespawnPosition(float &x, float &y, float &z, float* ori = NULL, float* dist =NULL) const;
 
         void SetCorpseDelay(uint32 delay) { m_corpseDelay = delay; }
@@ -617,6 +621,10 @@ class Creature : public Unit, public GridObject<Creature>, public MovableMapObje
         void UpdateMoveInLineOfSightState();
         bool IsMoveInLineOfSightDisabled() { return m_moveInLineOfSightDisabled; }
         bool IsMoveInLineOfSightStrictlyDisabled() { return m_moveInLineOfSightStrictlyDisabled; }
+        // true for creatures without script / SmartAI, their MoveInLineOfSight is the CreatureAI one or does nothing
+        bool HasDefaultMoveInLineOfSight() const { return m_defaultMoveInLineOfSight; }
+        // cheap necessary conditions of the default MoveInLineOfSight, false means it cannot react to who
+        bool IsMoveInLineOfSightCandidate(Unit const* who) const;
 
         MovementGeneratorType GetDefaultMovementType() const { return m_defaultMovementType; }
         void SetDefaultMovementType(MovementGeneratorType mgt) { m_defaultMovementType = mgt; }
@@ -751,6 +759,8 @@ class Creature : public Unit, public GridObject<Creature>, public MovableMapObje
         
         bool m_moveInLineOfSightDisabled;
         bool m_moveInLineOfSightStrictlyDisabled;
+        bool m_defaultMoveInLineOfSight;
+        uint32 m_postponedUpdateDiff;
 
         Position m_homePosition;
         Position m_transportHomePosition;
@@ -67,6 +67,7 @@
 #include "Vehicle.h"
 #include "Weather.h"
 #include "WeatherMgr.h"
+#include "WhoListCache.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -7726,6 +7727,7 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea)
         SendInitWorldStates(newZone, newArea);              // only if really enters to new zone, not just area change, works strange...
         if (Guild* guild = GetGuild())
             guild->UpdateMemberData(this, GUILD_MEMBER_DATA_ZONEID, newZone);
+        WhoListCacheMgr::UpdatePlayer(this);
     }
 
     // group update
@@ -27008,6 +27010,14 @@ void Player::SendDuelCountdown(uint32 counter)
     GetSession()->SendPacket(&data);
 }
 
+void Player::SetInGuild(uint32 GuildId)
+{
+    SetUInt32Value(PLAYER_GUILDID, GuildId);
+    // xinef: update global storage
+    sWorld->UpdateGlobalPlayerGuild(GetGUIDLow(), GuildId);
+    WhoListCacheMgr::UpdatePlayer(this);
+}
+
 void Player::SetIsSpectator(bool on)
 { 
     if (on)
@@ -80,6 +80,11 @@ bool PlayerSocial::AddToSocialList(uint32 friendGuid, bool ignore)
         fi.Flags |= flag;
         m_playerSocialMap[friendGuid] = fi;
     }
+
+    if (flag == SOCIAL_FLAG_FRIEND)
+        sSocialMgr->AddFriendLister(friendGuid, GetPlayerGUID());
+    else
+        sSocialMgr->AddIgnoreLister(friendGuid, GetPlayerGUID());
     return true;
 }
 
@@ -94,6 +99,11 @@ void PlayerSocial::RemoveFromSocialList(uint32 friendGuid, bool ignore)
         flag = SOCIAL_FLAG_IGNORED;
 
     itr->second.Flags &= ~flag;
+    if (flag == SOCIAL_FLAG_FRIEND)
+        sSocialMgr->RemoveFriendLister(friendGuid, GetPlayerGUID());
+    else
+        sSocialMgr->RemoveIgnoreLister(friendGuid, GetPlayerGUID());
+
     if (itr->second.Flags == 0)
     {
         PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHARACTER_SOCIAL);
@@ -288,12 +298,21 @@ void SocialMgr::BroadcastToFriendListers(Player* player, WorldPacket* packet)
     bool allowTwoSideWhoList = sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_WHO_LIST);
     AccountTypes gmLevelInWhoList = AccountTypes(sWorld->getIntConfig(CONFIG_GM_LEVEL_IN_WHO_LIST));
 
-    for (SocialMap::const_iterator itr = m_socialMap.begin(); itr != m_socialMap.end(); ++itr)
+    FriendListerMap::const_iterator listers = m_friendListers.find(guid);
+    if (listers == m_friendListers.end())
+        return;
+
+    // listers are ordered by guid, so packets go out in the same order as walking m_socialMap did
+    for (std::set<uint32>::const_iterator itr = listers->second.begin(); itr != listers->second.end(); ++itr)
     {
-        PlayerSocialMap::const_iterator itr2 = itr->second.m_playerSocialMap.find(guid);
-        if (itr2 != itr->second.m_playerSocialMap.end() && (itr2->second.Flags & SOCIAL_FLAG_FRIEND))
+        SocialMap::const_iterator social = m_socialMap.find(*itr);
+        if (social == m_socialMap.end())
+            continue;
+
+        PlayerSocialMap::const_iterator itr2 = social->second.m_playerSocialMap.find(guid);
+        if (itr2 != social->second.m_playerSocialMap.end() && (itr2->second.Flags & SOCIAL_FLAG_FRIEND))
         {
-            Player* pFriend = ObjectAccessor::FindPlayer(MAKE_NEW_GUID(itr->first, 0, HIGHGUID_PLAYER));
+            Player* pFriend = ObjectAccessor::FindPlayer(MAKE_NEW_GUID(*itr, 0, HIGHGUID_PLAYER));
 
             // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
             // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
@@ -324,6 +343,10 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, uint32 guid)
         note = fields[2].GetString();
 
         social->m_playerSocialMap[friendGuid] = FriendInfo(flags, note);
+        if (flags & SOCIAL_FLAG_FRIEND)
+            AddFriendLister(friendGuid, guid);
+        if (flags & SOCIAL_FLAG_IGNORED)
+            AddIgnoreLister(friendGuid, guid);
 
         // client's friends list and ignore list limit
         if (social->m_playerSocialMap.size() >= (SOCIALMGR_FRIEND_LIMIT + SOCIALMGR_IGNORE_LIMIT))
@@ -333,3 +356,56 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, uint32 guid)
 
     return social;
 }
+
+void SocialMgr::RemovePlayerSocial(uint32 guid)
+{
+    SocialMap::iterator itr = m_socialMap.find(guid);
+    if (itr == m_socialMap.end())
+        return;
+
+    for (PlayerSocialMap::const_iterator itr2 = itr->second.m_playerSocialMap.begin(); itr2 != itr->second.m_playerSocialMap.end(); ++itr2)
+    {
+        RemoveFriendLister(itr2->first, guid);
+        RemoveIgnoreLister(itr2->first, guid);
+    }
+
+    m_socialMap.erase(itr);
+}
+
+void SocialMgr::AddFriendLister(uint32 friendGuid, uint32 listerGuid)
+{
+    m_friendListers[friendGuid].insert(listerGuid);
+}
+
+void SocialMgr::RemoveFriendLister(uint32 friendGuid, uint32 listerGuid)
+{
+    FriendListerMap::iterator itr = m_friendListers.find(friendGuid);
+    if (itr == m_friendListers.end())
+        return;
+
+    itr->second.erase(listerGuid);
+    if (itr->second.empty())
+        m_friendListers.erase(itr);
+}
+
+void SocialMgr::AddIgnoreLister(uint32 ignoredGuid, uint32 listerGuid)
+{
+    m_ignoreListers[ignoredGuid].insert(listerGuid);
+}
+
+void SocialMgr::RemoveIgnoreLister(uint32 ignoredGuid, uint32 listerGuid)
+{
+    FriendListerMap::iterator itr = m_ignoreListers.find(ignoredGuid);
+    if (itr == m_ignoreListers.end())
+        return;
+
+    itr->second.erase(listerGuid);
+    if (itr->second.empty())
+        m_ignoreListers.erase(itr);
+}
+
+std::set<uint32> const* SocialMgr::GetIgnoreListers(uint32 ignoredGuid) const
+{
+    FriendListerMap::const_iterator itr = m_ignoreListers.find(ignoredGuid);
+    return itr != m_ignoreListers.end() ? &itr->second : NULL;
+}
@@ -51,6 +51,7 @@ struct FriendInfo
 
 typedef std::map<uint32, FriendInfo> PlayerSocialMap;
 typedef std::map<uint32, PlayerSocial> SocialMap;
+typedef std::unordered_map<uint32, std::set<uint32> > FriendListerMap;
 
 /// Results of friend related commands
 enum FriendsResult
@@ -120,7 +121,7 @@ class SocialMgr
 
     public:
         // Misc
-        void RemovePlayerSocial(uint32 guid) { m_socialMap.erase(guid); }
+        void RemovePlayerSocial(uint32 guid);
 
         void GetFriendInfo(Player* player, uint32 friendGUID, FriendInfo &friendInfo);
         // Packet management
@@ -129,8 +130,17 @@ class SocialMgr
         void BroadcastToFriendListers(Player* player, WorldPacket* packet);
         // Loading
         PlayerSocial *LoadFromDB(PreparedQueryResult result, uint32 guid);
+        // Reverse friend index
+        void AddFriendLister(uint32 friendGuid, uint32 listerGuid);
+        void RemoveFriendLister(uint32 friendGuid, uint32 listerGuid);
+        // Reverse ignore index
+        void AddIgnoreLister(uint32 ignoredGuid, uint32 listerGuid);
+        void RemoveIgnoreLister(uint32 ignoredGuid, uint32 listerGuid);
+        std::set<uint32> const* GetIgnoreListers(uint32 ignoredGuid) const;
     private:
         SocialMap m_socialMap;
+        FriendListerMap m_friendListers;                    // player -> loaded players who have him on their friend list
+        FriendListerMap m_ignoreListers;                    // player -> loaded players who have him on their ignore list
 };
 
 #define sSocialMgr ACE_Singleton<SocialMgr, ACE_Null_Mutex>::instance()
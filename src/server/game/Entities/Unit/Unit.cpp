@@ -52,6 +52,7 @@
 #include "ArenaSpectator.h"
 #include "DynamicVisibility.h"
 #include "AccountMgr.h"
+#include "WhoListCache.h"
 #include "../../../modules/mod-spellregulator/src/SpellRegulator.h"
 
 #ifdef ELUNA
@@ -4094,6 +4095,8 @@ void Unit::_RegisterAuraEffect(AuraEffect* aurEff, bool apply)
         m_modAuras[aurEff->GetAuraType()].push_back(aurEff);
     else
         m_modAuras[aurEff->GetAuraType()].remove(aurEff);
+
+    InvalidateAuraModifierCache(aurEff->GetAuraType());
 }
 
 // All aura base removes should go threw this function!
@@ -5198,55 +5201,83 @@ int32 Unit::GetTotalAuraModifierAreaExclusive(AuraType auratype) const
     return modifier + areaModifier;
 }
 
-int32 Unit::GetTotalAuraModifier(AuraType auratype) const
+void Unit::InvalidateAuraModifierCache(AuraType auratype)
 {
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    if (mTotalAuraList.empty())
-        return 0;
+    for (AuraModifierCacheList::iterator itr = m_auraModifierCache.begin(); itr != m_auraModifierCache.end(); ++itr)
+    {
+        if (itr->type == auratype)
+        {
+            *itr = m_auraModifierCache.back();
+            m_auraModifierCache.pop_back();
+            return;
+        }
+    }
+}
 
-    int32 modifier = 0;
+Unit::AuraModifierCache const& Unit::_GetAuraModifierCache(AuraType auratype) const
+{
+    // only a handful of aura types are queried per unit, a linear scan beats any lookup structure
+    for (AuraModifierCacheList::const_iterator itr = m_auraModifierCache.begin(); itr != m_auraModifierCache.end(); ++itr)
+        if (itr->type == auratype)
+            return *itr;
 
+    int32 total = 0;
+    int32 maxPositive = 0;
+    int32 maxNegative = 0;
+    float multiplier = 1.0f;
+
+    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
     for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        modifier += (*i)->GetAmount();
+    {
+        int32 amount = (*i)->GetAmount();
+        total += amount;
+        AddPct(multiplier, amount);
+        if (amount > maxPositive)
+            maxPositive = amount;
+        if (amount < maxNegative)
+            maxNegative = amount;
+    }
 
-    return modifier;
+    AuraModifierCache cache;
+    cache.type = auratype;
+    cache.total = total;
+    cache.maxPositive = maxPositive;
+    cache.maxNegative = maxNegative;
+    cache.multiplier = multiplier;
+    m_auraModifierCache.push_back(cache);
+    return m_auraModifierCache.back();
 }
 
-float Unit::GetTotalAuraMultiplier(AuraType auratype) const
+int32 Unit::GetTotalAuraModifier(AuraType auratype) const
 {
-    float multiplier = 1.0f;
+    if (m_modAuras[auratype].empty())
+        return 0;
 
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        AddPct(multiplier, (*i)->GetAmount());
+    return _GetAuraModifierCache(auratype).total;
+}
 
-    return multiplier;
+float Unit::GetTotalAuraMultiplier(AuraType auratype) const
+{
+    if (m_modAuras[auratype].empty())
+        return 1.0f;
+
+    return _GetAuraModifierCache(auratype).multiplier;
 }
 
 int32 Unit::GetMaxPositiveAuraModifier(AuraType auratype)
 {
-    int32 modifier = 0;
-
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-    {
-        if ((*i)->GetAmount() > modifier)
-            modifier = (*i)->GetAmount();
-    }
+    if (m_modAuras[auratype].empty())
+        return 0;
 
-    return modifier;
+    return _GetAuraModifierCache(auratype).maxPositive;
 }
 
 int32 Unit::GetMaxNegativeAuraModifier(AuraType auratype) const
 {
-    int32 modifier = 0;
-
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        if ((*i)->GetAmount() < modifier)
-            modifier = (*i)->GetAmount();
+    if (m_modAuras[auratype].empty())
+        return 0;
 
-    return modifier;
+    return _GetAuraModifierCache(auratype).maxNegative;
 }
 
 int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const
@@ -14176,7 +14207,10 @@ void Unit::SetLevel(uint8 lvl, bool showLevelChange)
 
     // xinef: update global data
     if (GetTypeId() == TYPEID_PLAYER)
+    {
         sWorld->UpdateGlobalPlayerData(ToPlayer()->GetGUIDLow(), PLAYER_UPDATE_DATA_LEVEL, "", lvl);
+        WhoListCacheMgr::UpdatePlayer(ToPlayer());
+    }
 }
 
 void Unit::SetHealth(uint32 val)
@@ -15035,10 +15069,17 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
     HealInfo healInfo = HealInfo(actor, actionTarget, damage, procSpell, procSpell ? SpellSchoolMask(procSpell->SchoolMask) : SPELL_SCHOOL_MASK_NORMAL);
     ProcEventInfo eventInfo = ProcEventInfo(actor, actionTarget, target, procFlag, 0, 0, procExtra, NULL, &damageInfo, &healInfo, procAura);
 
+    if (isVictim)
+        procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
+
     ProcTriggeredList procTriggered;
     // Fill procTriggered list
     for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin(); itr!= GetAppliedAuras().end(); ++itr)
     {
+        // Most auras can never proc from this event, skip them before any per aura lookups (see IsTriggeredAtSpellProcEvent)
+        if (!(procFlag & sSpellMgr->GetSpellProcEventFlags(itr->first)))
+            continue;
+
         // Do not allow auras to proc from effect triggered by itself
         if (procAura && procAura->Id == itr->first)
             continue;
@@ -15050,8 +15091,6 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         ProcTriggeredData triggerData(itr->second->GetBase());
         // Defensive procs are active on absorbs (so absorption effects are not a hindrance)
         bool active = damage || (procExtra & PROC_EX_BLOCK && isVictim);
-        if (isVictim)
-            procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
 
         SpellInfo const* spellProto = itr->second->GetBase()->GetSpellInfo();
 
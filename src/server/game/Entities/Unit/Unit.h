@@ -1910,6 +1910,7 @@ class Unit : public WorldObject
         void _RemoveNoStackAurasDueToAura(Aura* aura);
         bool _IsNoStackAuraDueToAura(Aura* appliedAura, Aura* existingAura) const;
         void _RegisterAuraEffect(AuraEffect* aurEff, bool apply);
+        void InvalidateAuraModifierCache(AuraType auraType);
 
         // m_ownedAuras container management
         AuraMap      & GetOwnedAuras()       { return m_ownedAuras; }
@@ -2483,6 +2484,20 @@ class Unit : public WorldObject
         uint32 m_removedAurasCount;
 
         AuraEffectList m_modAuras[TOTAL_AURAS];
+
+        // aggregates of m_modAuras for the aura types actually queried, dropped on change and rebuilt on the next query
+        struct AuraModifierCache
+        {
+            AuraType type;
+            int32 total;
+            int32 maxPositive;
+            int32 maxNegative;
+            float multiplier;
+        };
+        typedef std::vector<AuraModifierCache> AuraModifierCacheList;
+        mutable AuraModifierCacheList m_auraModifierCache;
+        AuraModifierCache const& _GetAuraModifierCache(AuraType auraType) const;
+
         AuraList m_scAuras;                        // casted singlecast auras
         AuraApplicationList m_interruptableAuras;             // auras which have interrupt mask applied on unit
         AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
@@ -8,6 +8,7 @@
 #include "AchievementMgr.h"
 #include "ArenaTeam.h"
 #include "ArenaTeamMgr.h"
+#include "BattlegroundMgr.h"
 #include "Chat.h"
 #include "Common.h"
 #include "DatabaseEnv.h"
@@ -36,6 +37,7 @@
 #include "Vehicle.h"
 #include "WaypointManager.h"
 #include "World.h"
+#include "WorldDataSnapshot.h"
 
 ScriptMapMap sSpellScripts;
 ScriptMapMap sEventScripts;
@@ -1643,10 +1645,53 @@ void ObjectMgr::LoadTempSummons()
     sLog->outString(">> Loaded %u temp summons in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
+struct CreatureSnapshotRecord
+{
+    uint32 guid;
+    bool addToGrid;
+    CreatureData data;
+};
+
 void ObjectMgr::LoadCreatures()
 {
     uint32 oldMSTime = getMSTime();
 
+    // zone / area calculation writes back to the database, it always needs a full load
+    WorldDataSnapshot snapshot("creature", sizeof(CreatureSnapshotRecord));
+    bool useSnapshot = WorldDataSnapshot::IsEnabled() && !sWorld->getBoolConfig(CONFIG_CALCULATE_CREATURE_ZONE_AREA_DATA);
+    if (useSnapshot)
+    {
+        snapshot.AddTableSource("creature");
+        snapshot.AddTableSource("game_event_creature");
+        snapshot.AddTableSource("pool_creature");
+        snapshot.AddTableSource("creature_template");
+        snapshot.AddTableSource("creature_equip_template");
+        snapshot.AddFileSource("dbc/Map.dbc");
+        snapshot.AddFileSource("dbc/MapDifficulty.dbc");
+
+        if (snapshot.Load())
+        {
+            uint32 count = 0;
+            _creatureDataStore.rehash(snapshot.GetRecordCount());
+            for (uint32 i = 0; i < snapshot.GetRecordCount(); ++i)
+            {
+                CreatureSnapshotRecord record;
+                memcpy(&record, snapshot.GetRecord(i), sizeof(record));
+
+                CreatureData& data = _creatureDataStore[record.guid];
+                data = record.data;
+                if (record.addToGrid)
+                    AddCreatureToGrid(record.guid, &data);
+
+                ++count;
+            }
+
+            sLog->outString(">> Loaded %u creatures from snapshot in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
+            sLog->outString();
+            return;
+        }
+    }
+
     //                                               0              1   2    3        4             5           6           7           8            9              10
     QueryResult result = WorldDatabase.Query("SELECT creature.guid, id, map, modelid, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, spawndist, "
     //   11               12         13       14            15         16         17          18          19                20                   21
@@ -1671,6 +1716,7 @@ void ObjectMgr::LoadCreatures()
                     spawnMasks[i] |= (1 << k);
 
     _creatureDataStore.rehash(result->GetRowCount());
+    std::unordered_set<uint32> gridGuids;
     uint32 count = 0;
     do
     {
@@ -1797,12 +1843,33 @@ void ObjectMgr::LoadCreatures()
 
         // Add to grid if not managed by the game event or pool system
         if (gameEvent == 0 && PoolId == 0)
+        {
             AddCreatureToGrid(guid, &data);
+            if (useSnapshot)
+                gridGuids.insert(guid);
+        }
 
         ++count;
 
     } while (result->NextRow());
 
+    if (useSnapshot)
+    {
+        // skipped rows stay in the store as well, keep them so a snapshot load is identical
+        ByteBuffer records(_creatureDataStore.size() * sizeof(CreatureSnapshotRecord));
+        for (CreatureDataContainer::const_iterator itr = _creatureDataStore.begin(); itr != _creatureDataStore.end(); ++itr)
+        {
+            CreatureSnapshotRecord record;
+            memset(&record, 0, sizeof(record));
+            record.guid = itr->first;
+            record.addToGrid = gridGuids.find(itr->first) != gridGuids.end();
+            record.data = itr->second;
+            records.append((uint8 const*)&record, sizeof(record));
+        }
+
+        snapshot.Save(records, _creatureDataStore.size());
+    }
+
     sLog->outString(">> Loaded %u creatures in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
     sLog->outString();
 }
@@ -5504,20 +5571,109 @@ void ObjectMgr::LoadNpcTextLocales()
 
 void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 {
-    uint32 oldMSTime = getMSTime();
+    ExpiredMailJob& job = _expiredMailJob;
 
-    time_t curTime = time(NULL);
+    // previous run is still in progress
+    if (job.Running)
+        return;
 
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
-    stmt->setUInt32(0, curTime);
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-    if (!result)
+    job.Running = true;
+    job.ServerUp = serverUp;
+    job.CurTime = time(NULL);
+    job.LastMailId = 0;
+    job.PageSize = std::max<uint32>(sWorld->getIntConfig(CONFIG_MAIL_EXPIRE_PAGE_SIZE), 1);
+    job.Deleted = 0;
+    job.Returned = 0;
+    job.StartMSTime = getMSTime();
+    job.LoggedInReceivers.clear();
+
+    if (serverUp)
+    {
+        job.MailsFuture = CharacterDatabase.AsyncQuery(GetOldMailPageStatement(CHAR_SEL_EXPIRED_MAIL));
+        job.ItemsFuture = CharacterDatabase.AsyncQuery(GetOldMailPageStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS));
         return;
+    }
+
+    // nobody is online during startup, go through all pages at once
+    for (;;)
+    {
+        PreparedQueryResult mails = CharacterDatabase.Query(GetOldMailPageStatement(CHAR_SEL_EXPIRED_MAIL));
+        PreparedQueryResult items = CharacterDatabase.Query(GetOldMailPageStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS));
+        if (!SetOldMailPage(mails, items))
+            break;
+
+        ProcessOldMailPage(0);
+        if (job.PageRows < job.PageSize)
+        {
+            FinishOldMails();
+            break;
+        }
+    }
+}
+
+void ObjectMgr::UpdateOldMails()
+{
+    ExpiredMailJob& job = _expiredMailJob;
+    if (!job.Running)
+        return;
+
+    if (!job.Mails)
+    {
+        // wait for both halves of the next page
+        if (!job.MailsFuture.ready() || !job.ItemsFuture.ready())
+            return;
+
+        PreparedQueryResult mails;
+        PreparedQueryResult items;
+        job.MailsFuture.get(mails);
+        job.ItemsFuture.get(items);
+        job.MailsFuture.cancel();
+        job.ItemsFuture.cancel();
+
+        if (!SetOldMailPage(mails, items))
+            return;
+    }
+
+    if (!ProcessOldMailPage(sWorld->getIntConfig(CONFIG_MAIL_EXPIRE_UPDATE_TIME)))
+        return;
+
+    if (job.PageRows < job.PageSize)
+        FinishOldMails();
+    else
+    {
+        job.LoggedInReceivers.clear();
+        job.MailsFuture = CharacterDatabase.AsyncQuery(GetOldMailPageStatement(CHAR_SEL_EXPIRED_MAIL));
+        job.ItemsFuture = CharacterDatabase.AsyncQuery(GetOldMailPageStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS));
+    }
+}
+
+void ObjectMgr::OnOldMailReceiverLogin(uint32 guidLow)
+{
+    // the player may take or return items of mails already read into the current page
+    if (_expiredMailJob.Running && _expiredMailJob.ServerUp)
+        _expiredMailJob.LoggedInReceivers.insert(guidLow);
+}
+
+PreparedStatement* ObjectMgr::GetOldMailPageStatement(CharacterDatabaseStatements index) const
+{
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(index);
+    stmt->setUInt32(0, _expiredMailJob.CurTime);
+    stmt->setUInt32(1, _expiredMailJob.LastMailId);
+    stmt->setUInt32(2, _expiredMailJob.PageSize);
+    return stmt;
+}
+
+bool ObjectMgr::SetOldMailPage(PreparedQueryResult mails, PreparedQueryResult items)
+{
+    ExpiredMailJob& job = _expiredMailJob;
+    if (!mails)
+    {
+        FinishOldMails();
+        return false;
+    }
 
-    std::map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
-    stmt->setUInt32(0, curTime);
-    if (PreparedQueryResult items = CharacterDatabase.Query(stmt))
+    job.Items.clear();
+    if (items)
     {
         MailItemInfo item;
         do
@@ -5526,104 +5682,143 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
             item.item_guid = fields[0].GetUInt32();
             item.item_template = fields[1].GetUInt32();
             uint32 mailId = fields[2].GetUInt32();
-            itemsCache[mailId].push_back(item);
+            job.Items[mailId].push_back(item);
         } while (items->NextRow());
     }
 
-    uint32 deletedCount = 0;
-    uint32 returnedCount = 0;
+    job.Mails = mails;
+    job.PageRows = mails->GetRowCount();
+    return true;
+}
+
+bool ObjectMgr::ProcessOldMailPage(uint32 timeBudget)
+{
+    ExpiredMailJob& job = _expiredMailJob;
+    uint32 oldMSTime = getMSTime();
+
+    // all changes made in one call go into a single transaction
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    bool hasNext;
     do
     {
-        Field* fields = result->Fetch();
-        Mail* m = new Mail;
-        m->messageID      = fields[0].GetUInt32();
-        m->messageType    = fields[1].GetUInt8();
-        m->sender         = fields[2].GetUInt32();
-        m->receiver       = fields[3].GetUInt32();
-        bool has_items    = fields[4].GetBool();
-        m->expire_time    = time_t(fields[5].GetUInt32());
-        m->deliver_time   = 0;
-        m->COD            = fields[6].GetUInt32();
-        m->checked        = fields[7].GetUInt8();
-        m->mailTemplateId = fields[8].GetInt16();
-
-        Player* player = NULL;
-        if (serverUp)
-            player = ObjectAccessor::FindPlayerInOrOutOfWorld(MAKE_NEW_GUID(m->receiver, 0, HIGHGUID_PLAYER));
-
-        if (player) // don't modify mails of a logged in player
-        {
-            delete m;
-            continue;
-        }
+        ProcessOldMail(job.Mails->Fetch(), trans);
+        hasNext = job.Mails->NextRow();
+    }
+    while (hasNext && (!timeBudget || GetMSTimeDiffToNow(oldMSTime) < timeBudget));
+    CharacterDatabase.CommitTransaction(trans);
 
-        // Delete or return mail
-        if (has_items)
-        {
-            // read items from cache
-            m->items.swap(itemsCache[m->messageID]);
+    // continue with this page on the next call
+    if (hasNext)
+        return false;
 
-            // don't return if: is mail from non-player, or sent to self, or already returned, or read and isn't COD
-            if (m->messageType != MAIL_NORMAL || m->receiver == m->sender || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)) || ((m->checked & MAIL_CHECK_MASK_READ) && !m->COD))
-            {
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                {
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
-                    stmt->setUInt32(0, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
-                }
+    job.Mails = PreparedQueryResult();
+    job.Items.clear();
+    return true;
+}
 
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
-                stmt->setUInt32(0, m->messageID);
-                CharacterDatabase.Execute(stmt);
-            }
-            else
-            {
-                // Mail will be returned
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
-                stmt->setUInt32(0, m->receiver);
-                stmt->setUInt32(1, m->sender);
-                stmt->setUInt32(2, curTime + 30 * DAY);
-                stmt->setUInt32(3, curTime);
-                stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
-                stmt->setUInt32(5, m->messageID);
-                CharacterDatabase.Execute(stmt);
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                {
-                    // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
-                    stmt->setUInt32(0, m->sender);
-                    stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
-
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
-                    stmt->setUInt32(0, m->sender);
-                    stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
-                }
+void ObjectMgr::ProcessOldMail(Field* fields, SQLTransaction& trans)
+{
+    ExpiredMailJob& job = _expiredMailJob;
+    PreparedStatement* stmt = NULL;
 
-                // xinef: update global data
-                sWorld->UpdateGlobalPlayerMails(m->sender, 1);
-                sWorld->UpdateGlobalPlayerMails(m->receiver, -1);
+    Mail* m = new Mail;
+    m->messageID      = fields[0].GetUInt32();
+    m->messageType    = fields[1].GetUInt8();
+    m->sender         = fields[2].GetUInt32();
+    m->receiver       = fields[3].GetUInt32();
+    bool has_items    = fields[4].GetBool();
+    m->expire_time    = time_t(fields[5].GetUInt32());
+    m->deliver_time   = 0;
+    m->COD            = fields[6].GetUInt32();
+    m->checked        = fields[7].GetUInt8();
+    m->mailTemplateId = fields[8].GetInt16();
 
-                delete m;
-                ++returnedCount;
-                continue;
-            }
-        }
+    job.LastMailId = m->messageID;
 
-        // xinef: update global data
-        sWorld->UpdateGlobalPlayerMails(m->receiver, -1);
+    Player* player = NULL;
+    if (job.ServerUp)
+        player = ObjectAccessor::FindPlayerInOrOutOfWorld(MAKE_NEW_GUID(m->receiver, 0, HIGHGUID_PLAYER));
 
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
-        stmt->setUInt32(0, m->messageID);
-        CharacterDatabase.Execute(stmt);
+    // don't modify mails of a logged in player, nor of one who logged in since the page was read
+    if (player || job.LoggedInReceivers.count(m->receiver))
+    {
         delete m;
-        ++deletedCount;
+        return;
     }
-    while (result->NextRow());
 
-    sLog->outString(">> Processed %u expired mails: %u deleted and %u returned in %u ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
+    // Delete or return mail
+    if (has_items)
+    {
+        // read items from cache
+        m->items.swap(job.Items[m->messageID]);
+
+        // don't return if: is mail from non-player, or sent to self, or already returned, or read and isn't COD
+        if (m->messageType != MAIL_NORMAL || m->receiver == m->sender || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)) || ((m->checked & MAIL_CHECK_MASK_READ) && !m->COD))
+        {
+            for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
+            {
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
+                stmt->setUInt32(0, itr2->item_guid);
+                trans->Append(stmt);
+            }
+
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
+            stmt->setUInt32(0, m->messageID);
+            trans->Append(stmt);
+        }
+        else
+        {
+            // Mail will be returned
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
+            stmt->setUInt32(0, m->receiver);
+            stmt->setUInt32(1, m->sender);
+            stmt->setUInt32(2, job.CurTime + 30 * DAY);
+            stmt->setUInt32(3, job.CurTime);
+            stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
+            stmt->setUInt32(5, m->messageID);
+            trans->Append(stmt);
+            for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
+            {
+                // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
+                stmt->setUInt32(0, m->sender);
+                stmt->setUInt32(1, itr2->item_guid);
+                trans->Append(stmt);
+
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
+                stmt->setUInt32(0, m->sender);
+                stmt->setUInt32(1, itr2->item_guid);
+                trans->Append(stmt);
+            }
+
+            // xinef: update global data
+            sWorld->UpdateGlobalPlayerMails(m->sender, 1);
+            sWorld->UpdateGlobalPlayerMails(m->receiver, -1);
+
+            delete m;
+            ++job.Returned;
+            return;
+        }
+    }
+
+    // xinef: update global data
+    sWorld->UpdateGlobalPlayerMails(m->receiver, -1);
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
+    stmt->setUInt32(0, m->messageID);
+    trans->Append(stmt);
+    delete m;
+    ++job.Deleted;
+}
+
+void ObjectMgr::FinishOldMails()
+{
+    ExpiredMailJob& job = _expiredMailJob;
+    job.Running = false;
+    job.Mails = PreparedQueryResult();
+    job.Items.clear();
+
+    sLog->outString(">> Processed %u expired mails: %u deleted and %u returned in %u ms", job.Deleted + job.Returned, job.Deleted, job.Returned, GetMSTimeDiffToNow(job.StartMSTime));
     sLog->outString();
 }
 
@@ -6248,6 +6443,10 @@ void ObjectMgr::SetHighestGuids()
     if (result)
         sArenaTeamMgr->SetLastArenaLogId((*result)[0].GetUInt32());
 
+    result = CharacterDatabase.Query("SELECT MAX(id) FROM pvpstats_battlegrounds");
+    if (result)
+        sBattlegroundMgr->SetLastPvPStatsId((*result)[0].GetUInt64());
+
     result = CharacterDatabase.Query("SELECT MAX(setguid) FROM character_equipmentsets");
     if (result)
         _equipmentSetGuid = (*result)[0].GetUInt64()+1;
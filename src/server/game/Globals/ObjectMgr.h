@@ -23,6 +23,7 @@
 #include "Map.h"
 #include "ObjectAccessor.h"
 #include "ObjectDefines.h"
+#include "Containers.h"
 #include <ace/Singleton.h>
 #include "VehicleDefines.h"
 #include <string>
@@ -30,6 +31,7 @@
 #include <limits>
 #include "ConditionMgr.h"
 #include <functional>
+#include <unordered_set>
 
 class Item;
 struct AccessRequirement;
@@ -463,7 +465,8 @@ struct BroadcastText
 
 typedef std::unordered_map<uint32, BroadcastText> BroadcastTextContainer;
 
-typedef std::set<uint32> CellGuidSet;
+// cells hold few spawns and are walked on every grid load, a sorted vector keeps them contiguous
+typedef Trinity::Containers::FlatSet<uint32> CellGuidSet;
 typedef std::unordered_map<uint32/*player guid*/, uint32/*instance*/> CellCorpseSet;
 struct CellObjectGuids
 {
@@ -683,6 +686,27 @@ typedef std::unordered_map<uint32, DungeonEncounterList> DungeonEncounterContain
 
 class PlayerDumpReader;
 
+// State of the expired mail job, which pages through the expired mails in id order
+struct ExpiredMailJob
+{
+    ExpiredMailJob() : Running(false), ServerUp(false), CurTime(0), LastMailId(0), PageSize(0), PageRows(0), Deleted(0), Returned(0), StartMSTime(0) { }
+
+    bool Running;
+    bool ServerUp;
+    time_t CurTime;
+    uint32 LastMailId;
+    uint32 PageSize;
+    PreparedQueryResultFuture MailsFuture;
+    PreparedQueryResultFuture ItemsFuture;
+    PreparedQueryResult Mails;                              // page being processed, positioned at the next mail
+    uint64 PageRows;
+    std::map<uint32 /*messageId*/, MailItemInfoVec> Items;
+    std::unordered_set<uint32> LoggedInReceivers;           // logged in after the page was queried, their rows may be stale
+    uint32 Deleted;
+    uint32 Returned;
+    uint32 StartMSTime;
+};
+
 class ObjectMgr
 {
     friend class PlayerDumpReader;
@@ -1051,7 +1075,11 @@ class ObjectMgr
             return itr != _fishingBaseForAreaStore.end() ? itr->second : 0;
         }
 
+        // At startup handles all expired mails at once, later only starts the job driven by UpdateOldMails
         void ReturnOrDeleteOldMails(bool serverUp);
+        void UpdateOldMails();
+        // Mails of the player are skipped until the next page is queried
+        void OnOldMailReceiverLogin(uint32 guidLow);
 
         CreatureBaseStats const* GetCreatureBaseStats(uint8 level, uint8 unitClass);
 
@@ -1412,6 +1440,14 @@ class ObjectMgr
         InstanceTemplateContainer _instanceTemplateStore;
 
     private:
+        PreparedStatement* GetOldMailPageStatement(CharacterDatabaseStatements index) const;
+        bool SetOldMailPage(PreparedQueryResult mails, PreparedQueryResult items);
+        bool ProcessOldMailPage(uint32 timeBudget);
+        void ProcessOldMail(Field* fields, SQLTransaction& trans);
+        void FinishOldMails();
+
+        ExpiredMailJob _expiredMailJob;
+
         void LoadScripts(ScriptsType type);
         void LoadQuestRelationsHelper(QuestRelations& map, std::string const& table, bool starter, bool go);
         void PlayerCreateInfoAddItemHelper(uint32 race_, uint32 class_, uint32 itemId, int32 count);
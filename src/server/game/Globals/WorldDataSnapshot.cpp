@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2016+     AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE-GPL2
+ */
+
+#include "WorldDataSnapshot.h"
+#include "ByteBuffer.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include "Timer.h"
+#include "World.h"
+
+#include <cstdio>
+
+namespace
+{
+    struct SnapshotHeader
+    {
+        char Magic[4];
+        uint32 Version;
+        uint32 RecordSize;
+        uint32 RecordCount;
+        uint64 Key;
+    };
+
+    char const SnapshotMagic[4] = { 'A', 'C', 'W', 'S' };
+
+    // 64 bit FNV-1a
+    void HashBytes(uint64& hash, void const* data, size_t length)
+    {
+        uint8 const* bytes = static_cast<uint8 const*>(data);
+        for (size_t i = 0; i < length; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= UI64LIT(1099511628211);
+        }
+    }
+}
+
+WorldDataSnapshot::WorldDataSnapshot(char const* name, uint32 recordSize) : _name(name), _recordSize(recordSize), _key(0), _records(NULL), _recordCount(0)
+{
+    _path = sWorld->GetDataPath() + _name + ".snapshot";
+}
+
+bool WorldDataSnapshot::IsEnabled()
+{
+    return sWorld->getBoolConfig(CONFIG_WORLD_DATA_SNAPSHOT);
+}
+
+void WorldDataSnapshot::AddTableSource(char const* table)
+{
+    _tables.push_back(table);
+}
+
+void WorldDataSnapshot::AddFileSource(char const* file)
+{
+    _files.push_back(file);
+}
+
+uint64 WorldDataSnapshot::ComputeKey()
+{
+    uint64 hash = UI64LIT(14695981039346656037);
+    uint32 version = WORLD_DATA_SNAPSHOT_VERSION;
+    HashBytes(hash, &version, sizeof(version));
+    HashBytes(hash, &_recordSize, sizeof(_recordSize));
+
+    // last applied world database update
+    if (QueryResult result = WorldDatabase.Query("SELECT COLUMN_NAME FROM information_schema.COLUMNS WHERE TABLE_SCHEMA = DATABASE() AND TABLE_NAME = 'version_db_world' ORDER BY ORDINAL_POSITION DESC LIMIT 1"))
+    {
+        std::string revision = result->Fetch()[0].GetString();
+        HashBytes(hash, revision.c_str(), revision.size());
+    }
+
+    // information_schema update times are cached by MySQL 8 and lost by InnoDB on restart,
+    // so only the table content itself is a reliable key
+    for (std::vector<std::string>::const_iterator itr = _tables.begin(); itr != _tables.end(); ++itr)
+    {
+        // CHECKSUM TABLE returns NULL for a missing table, which simply hashes as 0
+        uint64 checksum = 0;
+        if (QueryResult result = WorldDatabase.PQuery("CHECKSUM TABLE %s", itr->c_str()))
+            checksum = result->Fetch()[1].GetUInt64();
+
+        HashBytes(hash, itr->c_str(), itr->size());
+        HashBytes(hash, &checksum, sizeof(checksum));
+    }
+
+    for (std::vector<std::string>::const_iterator itr = _files.begin(); itr != _files.end(); ++itr)
+    {
+        HashBytes(hash, itr->c_str(), itr->size());
+
+        std::string path = sWorld->GetDataPath() + *itr;
+        if (FILE* file = fopen(path.c_str(), "rb"))
+        {
+            char buffer[4096];
+            size_t read;
+            while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+                HashBytes(hash, buffer, read);
+
+            fclose(file);
+        }
+    }
+
+    return hash;
+}
+
+bool WorldDataSnapshot::Load()
+{
+    // the key describes the data as it is before loading, a later Save() stores it unchanged
+    uint32 oldMSTime = getMSTime();
+    _key = ComputeKey();
+    sLog->outString(">> Snapshot key for %s computed in %u ms", _name.c_str(), GetMSTimeDiffToNow(oldMSTime));
+
+    if (_map.map(_path.c_str(), static_cast<size_t>(-1), O_RDONLY, ACE_DEFAULT_FILE_PERMS, PROT_READ, ACE_MAP_PRIVATE) == -1)
+        return false;
+
+    if (_map.size() < sizeof(SnapshotHeader))
+        return false;
+
+    SnapshotHeader header;
+    memcpy(&header, _map.addr(), sizeof(header));
+
+    if (memcmp(header.Magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0 || header.Version != WORLD_DATA_SNAPSHOT_VERSION ||
+        header.RecordSize != _recordSize || _map.size() != sizeof(SnapshotHeader) + size_t(header.RecordCount) * _recordSize)
+    {
+        sLog->outString(">> Snapshot %s has an unsupported format, rebuilding.", _path.c_str());
+        return false;
+    }
+
+    if (header.Key != _key)
+    {
+        sLog->outString(">> Snapshot %s is outdated, rebuilding.", _path.c_str());
+        return false;
+    }
+
+    _records = static_cast<uint8 const*>(_map.addr()) + sizeof(SnapshotHeader);
+    _recordCount = header.RecordCount;
+    return true;
+}
+
+void WorldDataSnapshot::Save(ByteBuffer const& records, uint32 count)
+{
+    ASSERT(records.size() == size_t(count) * _recordSize);
+    ASSERT(_key); // Load() must run first
+
+    _map.close();
+
+    SnapshotHeader header;
+    memcpy(header.Magic, SnapshotMagic, sizeof(SnapshotMagic));
+    header.Version = WORLD_DATA_SNAPSHOT_VERSION;
+    header.RecordSize = _recordSize;
+    header.RecordCount = count;
+    header.Key = _key;
+
+    // write to a temporary file first so a crash never leaves a truncated snapshot behind
+    std::string tmpPath = _path + ".tmp";
+    FILE* file = fopen(tmpPath.c_str(), "wb");
+    if (!file)
+    {
+        sLog->outError("WorldDataSnapshot: cannot create %s", tmpPath.c_str());
+        return;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && records.size())
+        ok = fwrite(records.contents(), records.size(), 1, file) == 1;
+
+    fclose(file);
+
+#if PLATFORM == PLATFORM_WINDOWS
+    // rename does not replace existing files on windows
+    remove(_path.c_str());
+#endif
+
+    if (!ok || rename(tmpPath.c_str(), _path.c_str()) != 0)
+    {
+        sLog->outError("WorldDataSnapshot: cannot write %s", _path.c_str());
+        remove(tmpPath.c_str());
+    }
+}
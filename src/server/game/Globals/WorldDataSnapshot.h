@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2016+     AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE-GPL2
+ */
+
+#ifndef _WORLDDATASNAPSHOT_H
+#define _WORLDDATASNAPSHOT_H
+
+#include "Define.h"
+#include <ace/Mem_Map.h>
+#include <string>
+#include <vector>
+
+class ByteBuffer;
+
+#define WORLD_DATA_SNAPSHOT_VERSION 1
+
+/// Versioned binary dump of a static world data container written after a successful load.
+/// The snapshot is keyed by a hash of the world DB revision, the table CHECKSUMs and the DBC
+/// files the container was built from, computed once before loading, and is memory-mapped on
+/// the next start when the key still matches.
+class WorldDataSnapshot
+{
+    public:
+        WorldDataSnapshot(char const* name, uint32 recordSize);
+
+        /// Adds a world database table whose CHECKSUM becomes part of the key
+        void AddTableSource(char const* table);
+        /// Adds a file (relative to DataDir) whose content becomes part of the key
+        void AddFileSource(char const* file);
+
+        /// Computes the key and maps the snapshot file, fails when it is missing, stale or written by another build
+        bool Load();
+        /// Writes `count` fixed size records, replacing any previous snapshot
+        void Save(ByteBuffer const& records, uint32 count);
+
+        uint32 GetRecordCount() const { return _recordCount; }
+        uint8 const* GetRecord(uint32 index) const { return _records + index * _recordSize; }
+
+        static bool IsEnabled();
+
+    private:
+        uint64 ComputeKey();
+
+        std::string _name;
+        std::string _path;
+        uint32 _recordSize;
+        std::vector<std::string> _tables;
+        std::vector<std::string> _files;
+        uint64 _key;
+
+        ACE_Mem_Map _map;
+        uint8 const* _records;
+        uint32 _recordCount;
+};
+
+#endif
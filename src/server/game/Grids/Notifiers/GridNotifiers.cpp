@@ -129,6 +129,10 @@ inline void CreatureUnitRelocationWorker(Creature* c, Unit* u)
 
     if (c->HasReactState(REACT_AGGRESSIVE) && !c->HasUnitState(UNIT_STATE_SIGHTLESS))
     {
+        // skip units the default AI cannot aggro before the visibility checks, stealthed players may still trigger an alert
+        if (c->HasDefaultMoveInLineOfSight() && !c->IsMoveInLineOfSightCandidate(u) && (u->GetTypeId() != TYPEID_PLAYER || !u->HasStealthAura()))
+            return;
+
         if (c->IsAIEnabled && c->CanSeeOrDetect(u, false, true))
         {
             c->AI()->MoveInLineOfSight_Safe(u);
@@ -325,6 +329,22 @@ void ObjectUpdater::Visit(GridRefManager<T> &m)
     }
 }
 
+void ObjectUpdater::Visit(CreatureMapType &m)
+{
+    Creature* creature;
+    for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); )
+    {
+        creature = iter->GetSource();
+        ++iter;
+        if (!creature->IsInWorld())
+            continue;
+
+        uint32 diff = i_timeDiff;
+        if (creature->PrepareUpdate(diff, i_idleUpdateInterval))
+            creature->Update(diff);
+    }
+}
+
 bool AnyDeadUnitObjectInRangeCheck::operator()(Player* u)
 {
     return !u->IsAlive() && !u->HasAuraType(SPELL_AURA_GHOST) && i_searchObj->IsWithinDistInMap(u, i_range);
@@ -355,6 +375,5 @@ bool AnyDeadUnitSpellTargetInRangeCheck::operator()(Creature* u)
     return AnyDeadUnitObjectInRangeCheck::operator()(u) && i_check(u);
 }
 
-template void ObjectUpdater::Visit<Creature>(CreatureMapType&);
 template void ObjectUpdater::Visit<GameObject>(GameObjectMapType&);
 template void ObjectUpdater::Visit<DynamicObject>(DynamicObjectMapType&);
@@ -140,8 +140,10 @@ namespace Trinity
     struct ObjectUpdater
     {
         uint32 i_timeDiff;
-        explicit ObjectUpdater(const uint32 diff) : i_timeDiff(diff) {}
+        uint32 i_idleUpdateInterval;                        // 0 = all creatures are updated every tick
+        explicit ObjectUpdater(const uint32 diff) : i_timeDiff(diff), i_idleUpdateInterval(0) {}
         template<class T> void Visit(GridRefManager<T> &m);
+        void Visit(CreatureMapType &m);
         void Visit(PlayerMapType &) {}
         void Visit(CorpseMapType &) {}
     };
@@ -1117,9 +1117,15 @@ Guild::Guild():
     m_createdDate(0),
     m_accountsNumber(0),
     m_bankMoney(0),
-    m_eventLog(NULL)
+    m_eventLog(NULL),
+    m_rosterVersion(1)
 {
     memset(&m_bankEventLog, 0, (GUILD_BANK_MAX_TABS + 1) * sizeof(LogHolder*));
+    for (uint8 i = 0; i < 2; ++i)
+    {
+        m_rosterCacheVersion[i] = 0;
+        m_rosterCacheTime[i] = 0;
+    }
 }
 
 Guild::~Guild()
@@ -1267,7 +1273,7 @@ void Guild::UpdateMemberData(Player* player, uint8 dataid, uint32 value)
                 sLog->outError("Guild::UpdateMemberData: Called with incorrect DATAID %u (value %u)", dataid, value);
                 return;
         }
-        //HandleRoster();
+        _InvalidateRoster();
     }
 }
 
@@ -1278,23 +1284,35 @@ void Guild::OnPlayerStatusChange(Player* player, uint32 flag, bool state)
         if (state)
             member->AddFlag(flag);
         else member->RemFlag(flag);
+        _InvalidateRoster();
     }
 }
 
 void Guild::HandleRoster(WorldSession* session)
 {
-    // Guess size
-    WorldPacket data(SMSG_GUILD_ROSTER, (4 + m_motd.length() + 1 + m_info.length() + 1 + 4 + _GetRanksSize() * (4 + 4 + GUILD_BANK_MAX_TABS * (4 + 4)) + m_members.size() * 50));
-    data << uint32(m_members.size());
-    data << m_motd;
-    data << m_info;
+    // Rebuild only after the roster changed, members request it again on most guild events
+    uint8 officerNotes = _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE) ? 1 : 0;
+    WorldPacket& data = m_rosterCache[officerNotes];
+    uint32 version = m_rosterVersion;
+    time_t now = sWorld->GetGameTime();
+    if (m_rosterCacheVersion[officerNotes] != version || m_rosterCacheTime[officerNotes] + GUILD_ROSTER_CACHE_MAX_AGE <= now)
+    {
+        // Guess size
+        data.Initialize(SMSG_GUILD_ROSTER, (4 + m_motd.length() + 1 + m_info.length() + 1 + 4 + _GetRanksSize() * (4 + 4 + GUILD_BANK_MAX_TABS * (4 + 4)) + m_members.size() * 50));
+        data << uint32(m_members.size());
+        data << m_motd;
+        data << m_info;
 
-    data << uint32(_GetRanksSize());
-    for (Ranks::const_iterator ritr = m_ranks.begin(); ritr != m_ranks.end(); ++ritr)
-        ritr->WritePacket(data);
+        data << uint32(_GetRanksSize());
+        for (Ranks::const_iterator ritr = m_ranks.begin(); ritr != m_ranks.end(); ++ritr)
+            ritr->WritePacket(data);
 
-    for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
-        itr->second->WritePacket(data, _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE));
+        for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
+            itr->second->WritePacket(data, officerNotes);
+
+        m_rosterCacheVersion[officerNotes] = version;
+        m_rosterCacheTime[officerNotes] = now;
+    }
 
 
 #if defined(ENABLE_EXTRAS) && defined(ENABLE_EXTRA_LOGS)
@@ -1338,6 +1356,7 @@ void Guild::HandleSetMOTD(WorldSession* session, std::string const& motd)
     else
     {
         m_motd = motd;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildMOTDChanged(this, motd);
 
@@ -1359,6 +1378,7 @@ void Guild::HandleSetInfo(WorldSession* session, std::string const& info)
     if (_HasRankRight(session->GetPlayer(), GR_RIGHT_MODIFY_GUILD_INFO))
     {
         m_info = info;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildInfoChanged(this, info);
 
@@ -1403,6 +1423,7 @@ void Guild::HandleSetLeader(WorldSession* session, std::string const& name)
         {
             _SetLeaderGUID(pNewLeader);
             pOldLeader->ChangeRank(GR_OFFICER);
+            _InvalidateRoster();
             _BroadcastEvent(GE_LEADER_CHANGED, 0, player->GetName().c_str(), name.c_str());
         }
     }
@@ -1434,6 +1455,7 @@ void Guild::HandleSetMemberNote(WorldSession* session, std::string const& name,
         else
             member->SetOfficerNote(note);
 
+        _InvalidateRoster();
         HandleRoster(session);
     }
 }
@@ -1451,6 +1473,7 @@ void Guild::HandleSetRankInfo(WorldSession* session, uint8 rankId, std::string c
 
         rankInfo->SetName(name);
         rankInfo->SetRights(rights);
+        _InvalidateRoster();
         _SetRankBankMoneyPerDay(rankId, moneyPerDay);
 
         for (GuildBankRightsAndSlotsVec::const_iterator itr = rightsAndSlots.begin(); itr != rightsAndSlots.end(); ++itr)
@@ -1667,6 +1690,7 @@ void Guild::HandleUpdateMemberRank(WorldSession* session, std::string const& nam
 
         uint32 newRankId = member->GetRankId() + (demote ? 1 : -1);
         member->ChangeRank(newRankId);
+        _InvalidateRoster();
         _LogEvent(demote ? GUILD_EVENT_LOG_DEMOTE_PLAYER : GUILD_EVENT_LOG_PROMOTE_PLAYER, player->GetGUIDLow(), GUID_LOPART(member->GetGUID()), newRankId);
         _BroadcastEvent(demote ? GE_DEMOTION : GE_PROMOTION, 0, player->GetName().c_str(), name.c_str(), _GetRankName(newRankId).c_str());
     }
@@ -1707,6 +1731,7 @@ void Guild::HandleRemoveRank(WorldSession* session, uint8 rankId)
     CharacterDatabase.Execute(stmt);
 
     m_ranks.pop_back();
+    _InvalidateRoster();
 
     _BroadcastEvent(GE_RANK_DELETED, 0);
 }
@@ -1789,7 +1814,9 @@ void Guild::HandleMemberLogout(WorldSession* session)
         member->SetStats(player);
         member->UpdateLogoutTime();
         member->ResetFlags();
+        _InvalidateRoster();
     }
+    m_onlineMembers.erase(player->GetGUIDLow());
     _BroadcastEvent(GE_SIGNED_OFF, player->GetGUID(), player->GetName().c_str());
 }
 
@@ -1927,6 +1954,8 @@ void Guild::SendLoginInfo(WorldSession* session)
     {
         member->SetStats(player);
         member->AddFlag(GUILDMEMBER_STATUS_ONLINE);
+        m_onlineMembers[player->GetGUIDLow()] = member;
+        _InvalidateRoster();
     }
 }
 
@@ -2143,7 +2172,7 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
     {
         WorldPacket data;
         ChatHandler::BuildChatPacket(data, officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, Language(language), session->GetPlayer(), NULL, msg);
-        for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
+        for (OnlineMembers::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
             if (Player* player = itr->second->FindPlayer())
                 if (_HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) && !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUIDLow()))
                     player->GetSession()->SendPacket(&data);
@@ -2152,7 +2181,7 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
 
 void Guild::BroadcastPacketToRank(WorldPacket* packet, uint8 rankId) const
 {
-    for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
+    for (OnlineMembers::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
         if (itr->second->IsRank(rankId))
             if (Player* player = itr->second->FindPlayer())
                 player->GetSession()->SendPacket(packet);
@@ -2160,7 +2189,7 @@ void Guild::BroadcastPacketToRank(WorldPacket* packet, uint8 rankId) const
 
 void Guild::BroadcastPacket(WorldPacket* packet) const
 {
-    for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
+    for (OnlineMembers::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
         if (Player* player = itr->second->FindPlayer())
             player->GetSession()->SendPacket(packet);
 }
@@ -2266,6 +2295,7 @@ bool Guild::AddMember(uint64 guid, uint8 rankId)
 
     SQLTransaction trans(NULL);
     member->SaveToDB(trans);
+    _InvalidateRoster();
 
     _UpdateAccountsNumber();
     _LogEvent(GUILD_EVENT_LOG_JOIN_GUILD, lowguid);
@@ -2323,6 +2353,8 @@ void Guild::DeleteMember(uint64 guid, bool isDisbanding, bool isKicked, bool can
     if (Member* member = GetMember(guid))
         delete member;
     m_members.erase(lowguid);
+    m_onlineMembers.erase(lowguid);
+    _InvalidateRoster();
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
     if (player)
@@ -2344,6 +2376,7 @@ bool Guild::ChangeMemberRank(uint64 guid, uint8 newRank)
         if (Member* member = GetMember(guid))
         {
             member->ChangeRank(newRank);
+            _InvalidateRoster();
             return true;
         }
     return false;
@@ -2417,6 +2450,7 @@ void Guild::_CreateNewBankTab()
         (*itr).CreateMissingTabsIfNeeded(tabId, trans, false);
 
     CharacterDatabase.CommitTransaction(trans);
+    _InvalidateRoster();
 }
 
 void Guild::_CreateDefaultGuildRanks(LocaleConstant loc)
@@ -2445,6 +2479,7 @@ bool Guild::_CreateRank(std::string const& name, uint32 rights)
     // Ranks represent sequence 0, 1, 2, ... where 0 means guildmaster
     RankInfo info(m_id, newRankId, name, rights, 0);
     m_ranks.push_back(info);
+    _InvalidateRoster();
 
     SQLTransaction trans = CharacterDatabase.BeginTransaction();
     info.CreateMissingTabsIfNeeded(_GetPurchasedTabsSize(), trans);
@@ -2515,6 +2550,7 @@ void Guild::_SetLeaderGUID(Member* pLeader)
 
     m_leaderGuid = pLeader->GetGUID();
     pLeader->ChangeRank(GR_GUILDMASTER);
+    _InvalidateRoster();
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_LEADER);
     stmt->setUInt32(0, GUID_LOPART(m_leaderGuid));
@@ -2525,7 +2561,10 @@ void Guild::_SetLeaderGUID(Member* pLeader)
 void Guild::_SetRankBankMoneyPerDay(uint8 rankId, uint32 moneyPerDay)
 {
     if (RankInfo* rankInfo = GetRankInfo(rankId))
+    {
         rankInfo->SetBankMoneyPerDay(moneyPerDay);
+        _InvalidateRoster();
+    }
 }
 
 void Guild::_SetRankBankTabRightsAndSlots(uint8 rankId, GuildBankRightsAndSlots rightsAndSlots, bool saveToDB)
@@ -2534,7 +2573,10 @@ void Guild::_SetRankBankTabRightsAndSlots(uint8 rankId, GuildBankRightsAndSlots
         return;
 
     if (RankInfo* rankInfo = GetRankInfo(rankId))
+    {
         rankInfo->SetBankTabSlotsAndRights(rightsAndSlots, saveToDB);
+        _InvalidateRoster();
+    }
 }
 
 inline std::string Guild::_GetRankName(uint8 rankId) const
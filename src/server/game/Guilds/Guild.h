@@ -12,6 +12,7 @@
 #include "WorldPacket.h"
 #include "ObjectMgr.h"
 #include "Player.h"
+#include <atomic>
 
 class Item;
 
@@ -27,6 +28,7 @@ enum GuildMisc
     GUILD_WITHDRAW_SLOT_UNLIMITED       = 0xFFFFFFFF,
     GUILD_EVENT_LOG_GUID_UNDEFINED      = 0xFFFFFFFF,
     TAB_UNDEFINED                       = 0xFF,
+    GUILD_ROSTER_CACHE_MAX_AGE          = 60,                   // seconds, offline members show the time since their logout
 };
 
 enum GuildMemberData
@@ -651,6 +653,7 @@ private:
     typedef std::unordered_map<uint32, Member*> Members;
     typedef std::vector<RankInfo> Ranks;
     typedef std::vector<BankTab*> BankTabs;
+    typedef std::unordered_map<uint32, Member*> OnlineMembers;
 
 public:
     static void SendCommandResult(WorldSession* session, GuildCommandType type, GuildCommandError errCode, std::string const& param = "");
@@ -728,7 +731,7 @@ public:
     template<class Do>
     void BroadcastWorker(Do& _do, Player* except = NULL)
     {
-        for (Members::iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
+        for (OnlineMembers::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
             if (Player* player = itr->second->FindPlayer())
                 if (player != except)
                     _do(player);
@@ -770,6 +773,16 @@ protected:
     Members m_members;
     BankTabs m_bankTabs;
 
+    // Online members, added in SendLoginInfo and removed on logout or leaving. The player is looked up
+    // on every send, a relog through EnableLoginAfterDC keeps the entry but replaces the session.
+    OnlineMembers m_onlineMembers;
+
+    // SMSG_GUILD_ROSTER built for the current roster version, [1] includes officer notes
+    std::atomic<uint32> m_rosterVersion;
+    WorldPacket m_rosterCache[2];
+    uint32 m_rosterCacheVersion[2];
+    time_t m_rosterCacheTime[2];
+
     // These are actually ordered lists. The first element is the oldest entry.
     LogHolder* m_eventLog;
     LogHolder* m_bankEventLog[GUILD_BANK_MAX_TABS + 1];
@@ -788,6 +801,9 @@ private:
 
     inline uint8 _GetLowestRankId() const { return uint8(m_ranks.size() - 1); }
 
+    // Anything written to SMSG_GUILD_ROSTER changed, may be called from map threads (zone and level updates)
+    inline void _InvalidateRoster() { ++m_rosterVersion; }
+
     inline uint8 _GetPurchasedTabsSize() const { return uint8(m_bankTabs.size()); }
     inline BankTab* GetBankTab(uint8 tabId) { return tabId < m_bankTabs.size() ? m_bankTabs[tabId] : NULL; }
     inline const BankTab* GetBankTab(uint8 tabId) const { return tabId < m_bankTabs.size() ? m_bankTabs[tabId] : NULL; }
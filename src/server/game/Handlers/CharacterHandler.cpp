@@ -35,6 +35,7 @@
 #include "GitRevision.h"
 #include "UpdateMask.h"
 #include "Util.h"
+#include "WhoListCache.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -875,6 +876,9 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder* holder)
 {
     uint64 playerGuid = holder->GetGuid();
 
+    // the expired mail job may hold rows of this player's mails read before the login
+    sObjectMgr->OnOldMailReceiverLogin(GUID_LOPART(playerGuid));
+
     Player* pCurrChar = new Player(this);
      // for send server info and strings (config)
     ChatHandler chH = ChatHandler(this);
@@ -986,6 +990,8 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder* holder)
 
     //sLog->outDebug("Player %s added to Map.", pCurrChar->GetName().c_str());
 
+    WhoListCacheMgr::AddPlayer(pCurrChar);
+
     // pussywizard: optimization
     std::string charName = pCurrChar->GetName();
     std::transform(charName.begin(), charName.end(), charName.begin(), ::tolower);
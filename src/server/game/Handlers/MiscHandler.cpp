@@ -293,115 +293,101 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
     data << uint32(matchcount);                           // placeholder, count of players matching criteria
     data << uint32(displaycount);                         // placeholder, count of players displayed
 
-    TRINITY_READ_GUARD(HashMapHolder<Player>::LockType, *HashMapHolder<Player>::GetLock());
-    HashMapHolder<Player>::MapType const& m = sObjectAccessor->GetPlayers();
-    for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
+    TRINITY_GUARD(ACE_Thread_Mutex, WhoListCacheMgr::GetLock());
+    WhoListCacheMgr::WhoListMap const& whoList = WhoListCacheMgr::GetWhoList();
+    for (uint8 teamId = TEAM_ALLIANCE; teamId <= TEAM_HORDE; ++teamId)
     {
-        if (AccountMgr::IsPlayerAccount(security))
-        {
-            // player can see member of other team only if CONFIG_ALLOW_TWO_SIDE_WHO_LIST
-            if (itr->second->GetTeamId() != team  && !allowTwoSideWhoList)
-                continue;
-
-            // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if CONFIG_GM_IN_WHO_LIST
-            if ((itr->second->GetSession()->GetSecurity() > AccountTypes(gmLevelInWhoList)))
-                continue;
-        }
-
-        //do not process players which are not in world
-        if (!(itr->second->IsInWorld()))
-            continue;
-
-        // check if target is globally visible for player
-        if (!(itr->second->IsVisibleGloballyFor(_player)))
+        // player can see member of other team only if CONFIG_ALLOW_TWO_SIDE_WHO_LIST
+        if (AccountMgr::IsPlayerAccount(security) && teamId != team && !allowTwoSideWhoList)
             continue;
 
         // check if target's level is in level range
-        uint8 lvl = itr->second->getLevel();
-        if (lvl < level_min || lvl > level_max)
-            continue;
-
-        // check if class matches classmask
-        uint32 class_ = itr->second->getClass();
-        if (!(classmask & (1 << class_)))
-            continue;
-
-        // check if race matches racemask
-        uint32 race = itr->second->getRace();
-        if (!(racemask & (1 << race)))
-            continue;
-
-        uint32 pzoneid = itr->second->GetZoneId();
-        uint8 gender = itr->second->getGender();
+        if (level_min > level_max)
+            break;
 
-        bool z_show = true;
-        for (uint32 i = 0; i < zones_count; ++i)
+        WhoListCacheMgr::WhoListMap::const_iterator itr = whoList.lower_bound(WhoListCacheMgr::MakeKey(TeamId(teamId), uint8(level_min), 0));
+        WhoListCacheMgr::WhoListMap::const_iterator end = whoList.upper_bound(WhoListCacheMgr::MakeKey(TeamId(teamId), uint8(level_max), 0xFFFFFFFF));
+        for (; itr != end; ++itr)
         {
-            if (zoneids[i] == pzoneid)
-            {
-                z_show = true;
-                break;
-            }
+            WhoListPlayerInfo const& info = itr->second;
 
-            z_show = false;
-        }
-        if (!z_show)
-            continue;
+            // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if CONFIG_GM_IN_WHO_LIST
+            if (AccountMgr::IsPlayerAccount(security) && info.security > AccountTypes(gmLevelInWhoList))
+                continue;
 
-        std::string pname = itr->second->GetName();
-        std::wstring wpname;
-        if (!Utf8toWStr(pname, wpname))
-            continue;
-        wstrToLower(wpname);
+            // check if class matches classmask
+            if (!(classmask & (1 << info.clas)))
+                continue;
 
-        if (!(wplayer_name.empty() || wpname.find(wplayer_name) != std::wstring::npos))
-            continue;
+            // check if race matches racemask
+            if (!(racemask & (1 << info.race)))
+                continue;
 
-        std::string gname = sGuildMgr->GetGuildNameById(itr->second->GetGuildId());
-        std::wstring wgname;
-        if (!Utf8toWStr(gname, wgname))
-            continue;
-        wstrToLower(wgname);
+            bool z_show = true;
+            for (uint32 i = 0; i < zones_count; ++i)
+            {
+                if (zoneids[i] == info.zoneid)
+                {
+                    z_show = true;
+                    break;
+                }
 
-        if (!(wguild_name.empty() || wgname.find(wguild_name) != std::wstring::npos))
-            continue;
+                z_show = false;
+            }
+            if (!z_show)
+                continue;
 
-        std::string aname;
-        if (AreaTableEntry const* areaEntry = sAreaTableStore.LookupEntry(itr->second->GetZoneId()))
-            aname = areaEntry->area_name[GetSessionDbcLocale()];
+            if (!(wplayer_name.empty() || info.wpname.find(wplayer_name) != std::wstring::npos))
+                continue;
 
-        bool s_show = true;
-        for (uint32 i = 0; i < str_count; ++i)
-        {
-            if (!str[i].empty())
+            if (!(wguild_name.empty() || info.wgname.find(wguild_name) != std::wstring::npos))
+                continue;
+
+            bool s_show = true;
+            if (str_count)
             {
-                if (wgname.find(str[i]) != std::wstring::npos ||
-                    wpname.find(str[i]) != std::wstring::npos ||
-                    Utf8FitTo(aname, str[i]))
+                std::string aname;
+                if (AreaTableEntry const* areaEntry = sAreaTableStore.LookupEntry(info.zoneid))
+                    aname = areaEntry->area_name[GetSessionDbcLocale()];
+
+                for (uint32 i = 0; i < str_count; ++i)
                 {
-                    s_show = true;
-                    break;
+                    if (!str[i].empty())
+                    {
+                        if (info.wgname.find(str[i]) != std::wstring::npos ||
+                            info.wpname.find(str[i]) != std::wstring::npos ||
+                            Utf8FitTo(aname, str[i]))
+                        {
+                            s_show = true;
+                            break;
+                        }
+                        s_show = false;
+                    }
                 }
-                s_show = false;
             }
-        }
-        if (!s_show)
-            continue;
+            if (!s_show)
+                continue;
 
-        // 49 is maximum player count sent to client - can be overridden
-        // through config, but is unstable
-        if ((matchcount++) >= 50 /*sWorld->getIntConfig(CONFIG_MAX_WHO)*/)
-            continue;
+            // do not process players which are not in world and check if target is globally visible for player
+            Player* target = ObjectAccessor::FindPlayer(MAKE_NEW_GUID(info.guid, 0, HIGHGUID_PLAYER));
+            if (!target || !target->IsVisibleGloballyFor(_player))
+                continue;
 
-        data << pname;                                    // player name
-        data << gname;                                    // guild name
-        data << uint32(lvl);                              // player level
-        data << uint32(class_);                           // player class
-        data << uint32(race);                             // player race
-        data << uint8(gender);                            // player gender
-        data << uint32(pzoneid);                          // player zone id
+            // 49 is maximum player count sent to client - can be overridden
+            // through config, but is unstable
+            if ((matchcount++) >= 50 /*sWorld->getIntConfig(CONFIG_MAX_WHO)*/)
+                continue;
+
+            data << info.pname;                               // player name
+            data << info.gname;                               // guild name
+            data << uint32(WhoListCacheMgr::GetKeyLevel(itr->first)); // player level
+            data << uint32(info.clas);                        // player class
+            data << uint32(info.race);                        // player race
+            data << uint8(info.gender);                       // player gender
+            data << uint32(info.zoneid);                      // player zone id
 
-        ++displaycount;
+            ++displaycount;
+        }
     }
 
     data.put(0, displaycount);                            // insert right count, count displayed
@@ -19,6 +19,7 @@
 #include "GossipDef.h"
 #include "SocialMgr.h"
 #include "PetitionMgr.h"
+#include "WhoListCache.h"
 
 #define CHARTER_DISPLAY_ID 16161
 
@@ -798,6 +799,8 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket & recvData)
 
         // Register guild and add guild master
         sGuildMgr->AddGuild(guild);
+        // the guild name could not be resolved while the guild master was added in Create
+        WhoListCacheMgr::UpdatePlayer(_player);
 
         Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_COMMAND_SUCCESS, name);
 
@@ -620,7 +620,7 @@ bool Map::IsGridLoaded(const GridCoord &p) const
     return (getNGrid(p.x_coord, p.y_coord) && isGridObjectDataLoaded(p.x_coord, p.y_coord));
 }
 
-void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor)
+void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor, std::vector<uint32>* farCells)
 { 
     // Check for valid position
     if (!obj->IsPositionValid())
@@ -630,7 +630,8 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::Obj
         return;
 
     // Update mobs/objects in ALL visible cells around object!
-    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), obj->GetGridActivationRange());
+    float range = obj->GetGridActivationRange();
+    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), range);
 
     for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
     {
@@ -642,6 +643,20 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::Obj
             if (isCellMarked(cell_id))
                 continue;
 
+            // corners of the area which are completely out of range are left to the caller
+            if (farCells)
+            {
+                float lowX = (float(x) - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL;
+                float lowY = (float(y) - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL;
+                float dx = std::max(0.0f, std::max(lowX - obj->GetPositionX(), obj->GetPositionX() - (lowX + SIZE_OF_GRID_CELL)));
+                float dy = std::max(0.0f, std::max(lowY - obj->GetPositionY(), obj->GetPositionY() - (lowY + SIZE_OF_GRID_CELL)));
+                if (dx * dx + dy * dy > range * range)
+                {
+                    farCells->push_back(cell_id);
+                    continue;
+                }
+            }
+
             markCell(cell_id);
             CellCoord pair(x, y);
             Cell cell(pair);
@@ -702,6 +717,12 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     // pussywizard: container for far creatures in combat with players
     std::vector<Creature*> updateList; updateList.reserve(10);
 
+    // idle creatures which no player can see are updated at a reduced rate, so cells in sight
+    // of players, around their far away attackers and around non-player active objects are
+    // visited first, the remaining far cells afterwards with the idle interval set
+    uint32 idleUpdateInterval = sWorld->getIntConfig(CONFIG_CREATURE_IDLE_UPDATE_INTERVAL);
+    std::vector<uint32> farCells;
+
     // the player iterator is stored in the map object
     // to make sure calls to Map::Remove don't invalidate it
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
@@ -714,7 +735,7 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         // update players at tick
         player->Update(s_diff);
 
-        VisitNearbyCellsOf(player, grid_object_update, world_object_update);
+        VisitNearbyCellsOf(player, grid_object_update, world_object_update, idleUpdateInterval ? &farCells : NULL);
 
         // handle updates for creatures in combat with player and are more than X yards away
         if (player->IsInCombat())
@@ -747,6 +768,19 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
     }
 
+    // only far cells no player or active object has visited are left
+    updater.i_idleUpdateInterval = idleUpdateInterval;
+    for (std::vector<uint32>::const_iterator itr = farCells.begin(); itr != farCells.end(); ++itr)
+    {
+        if (isCellMarked(*itr))
+            continue;
+
+        markCell(*itr);
+        Cell cell(CellCoord(*itr % TOTAL_NUMBER_OF_CELLS_PER_MAP, *itr / TOTAL_NUMBER_OF_CELLS_PER_MAP));
+        Visit(cell, grid_object_update);
+        Visit(cell, world_object_update);
+    }
+
     for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();) // pussywizard: transports updated after VisitNearbyCellsOf, grids around are loaded, everything ok
     {
         MotionTransport* transport = *_transportsUpdateIter;
@@ -2175,6 +2209,18 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
     return true;
 }
 
+void Map::isInLineOfSight(G3D::Vector3 const* sources, bool* results, uint32 count, float x, float y, float z, uint32 phasemask, LineOfSightChecks checks) const
+{
+    std::fill(results, results + count, true);
+
+    // sources already blocked by vmaps are skipped by the gameobject check
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
+        VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), sources, results, count, x, y, z);
+
+    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT))
+        _dynamicTree.isInLineOfSight(sources, results, count, x, y, z, phasemask);
+}
+
 bool Map::getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
 { 
     G3D::Vector3 startPos(x1, y1, z1);
@@ -2926,6 +2972,15 @@ void BattlegroundMap::RemovePlayerFromMap(Player* player, bool remove)
     Map::RemovePlayerFromMap(player, remove);
 }
 
+void BattlegroundMap::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread*/)
+{
+    Map::Update(t_diff, s_diff);
+
+    // battleground logic runs together with its map, BattlegroundMgr only updates battlegrounds without a map
+    if (m_bg)
+        m_bg->Update(s_diff);
+}
+
 void BattlegroundMap::SetUnload()
 { 
     m_unloadTimer = MIN_UNLOAD_DELAY;
@@ -1,46 +1,64 @@
 #include "WhoListCache.h"
 #include "World.h"
-#include "ObjectAccessor.h"
 #include "Player.h"
 #include "GuildMgr.h"
 
-std::vector<WhoListPlayerInfo> WhoListCacheMgr::m_whoOpcodeList;
+WhoListCacheMgr::WhoListMap WhoListCacheMgr::m_whoList;
+std::unordered_map<uint32, uint64> WhoListCacheMgr::m_playerKeys;
+ACE_Thread_Mutex WhoListCacheMgr::m_lock;
 
-void WhoListCacheMgr::Update()
+void WhoListCacheMgr::AddPlayer(Player* player)
 {
-    // clear current list
-    m_whoOpcodeList.clear();
-    m_whoOpcodeList.reserve(sWorld->GetPlayerCount()+1);
-
-    TRINITY_READ_GUARD(HashMapHolder<Player>::LockType, *HashMapHolder<Player>::GetLock());
-    HashMapHolder<Player>::MapType const& m = sObjectAccessor->GetPlayers();
-    for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
-    {
-        if (!itr->second->FindMap() || itr->second->GetSession()->PlayerLoading())
-            continue;
-
-        if (itr->second->GetSession()->GetSecurity() > SEC_PLAYER)
-            continue;
-
-        std::string pname = itr->second->GetName();
-        std::wstring wpname;
-        if (!Utf8toWStr(pname, wpname))
-            continue;
-        wstrToLower(wpname);
-
-        std::string gname = sGuildMgr->GetGuildNameById(itr->second->GetGuildId());
-        std::wstring wgname;
-        if (!Utf8toWStr(gname, wgname))
-            continue;
-        wstrToLower(wgname);
-
-        std::string aname;
-        if (AreaTableEntry const* areaEntry = sAreaTableStore.LookupEntry(itr->second->GetZoneId()))
-            aname = areaEntry->area_name[sWorld->GetDefaultDbcLocale()];
-
-        if (itr->second->IsSpectator())
-            aname = "Dalaran";
-
-        m_whoOpcodeList.push_back( WhoListPlayerInfo(itr->second->GetTeamId(), itr->second->GetSession()->GetSecurity(), itr->second->getLevel(), itr->second->getClass(), itr->second->getRace(), (itr->second->IsSpectator() ? 4395 /*Dalaran*/ : itr->second->GetZoneId()), itr->second->getGender(), wpname, wgname, aname, pname, gname) );
-    }
-}
\ No newline at end of file
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    Erase(player->GetGUIDLow());
+    Insert(player);
+}
+
+void WhoListCacheMgr::UpdatePlayer(Player* player)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    // players which are still loading are added on login
+    if (Erase(player->GetGUIDLow()))
+        Insert(player);
+}
+
+void WhoListCacheMgr::RemovePlayer(Player* player)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    Erase(player->GetGUIDLow());
+}
+
+void WhoListCacheMgr::Insert(Player* player)
+{
+    WhoListPlayerInfo info;
+    info.guid = player->GetGUIDLow();
+    info.security = player->GetSession()->GetSecurity();
+    info.clas = player->getClass();
+    info.race = player->getRace();
+    info.zoneid = player->GetZoneId();
+    info.gender = player->getGender();
+    info.pname = player->GetName();
+    info.gname = sGuildMgr->GetGuildNameById(player->GetGuildId());
+
+    uint64 key = MakeKey(player->GetTeamId(), player->getLevel(), info.guid);
+    m_playerKeys[info.guid] = key;
+
+    // names which cannot be converted never match a who request, the player stays known for later updates
+    if (!Utf8toWStr(info.pname, info.wpname) || !Utf8toWStr(info.gname, info.wgname))
+        return;
+    wstrToLower(info.wpname);
+    wstrToLower(info.wgname);
+
+    m_whoList[key] = info;
+}
+
+bool WhoListCacheMgr::Erase(uint32 guid)
+{
+    std::unordered_map<uint32, uint64>::iterator itr = m_playerKeys.find(guid);
+    if (itr == m_playerKeys.end())
+        return false;
+
+    m_whoList.erase(itr->second);
+    m_playerKeys.erase(itr);
+    return true;
+}
@@ -3,34 +3,49 @@
 
 #include "Common.h"
 #include "SharedDefines.h"
+#include <ace/Thread_Mutex.h>
+
+class Player;
 
 struct WhoListPlayerInfo
 {
-    TeamId teamId;
+    uint32 guid;
     AccountTypes security;
-    uint8 level;
     uint8 clas;
     uint8 race;
     uint32 zoneid;
     uint8 gender;
     std::wstring wpname;
     std::wstring wgname;
-    std::string aname;
     std::string pname;
     std::string gname;
-
-    WhoListPlayerInfo(TeamId teamId, AccountTypes security, uint8 level, uint8 clas, uint8 race, uint32 zoneid, uint8 gender, std::wstring wpname, std::wstring wgname, std::string aname, std::string pname, std::string gname) :
-    teamId(teamId), security(security), level(level), clas(clas), race(race), zoneid(zoneid), gender(gender), wpname(wpname), wgname(wgname), aname(aname), pname(pname), gname(gname) {}
 };
 
+// Online players for CMSG_WHO, kept up to date on login, logout, level, zone and guild changes.
+// Entries are ordered by team, level and guid so a query only walks the requested level range.
 class WhoListCacheMgr
 {
 public:
-    static void Update();
-    static std::vector<WhoListPlayerInfo> * GetWhoList() { return &m_whoOpcodeList; }
+    typedef std::map<uint64, WhoListPlayerInfo> WhoListMap;
+
+    static void AddPlayer(Player* player);
+    static void UpdatePlayer(Player* player);
+    static void RemovePlayer(Player* player);
+
+    static uint64 MakeKey(TeamId teamId, uint8 level, uint32 guid) { return (uint64(teamId) << 40) | (uint64(level) << 32) | guid; }
+    static uint8 GetKeyLevel(uint64 key) { return uint8(key >> 32); }
+
+    // callers must hold GetLock() while using the list
+    static WhoListMap const& GetWhoList() { return m_whoList; }
+    static ACE_Thread_Mutex& GetLock() { return m_lock; }
 
 protected:
-    static std::vector<WhoListPlayerInfo> m_whoOpcodeList;
+    static void Insert(Player* player);
+    static bool Erase(uint32 guid);
+
+    static WhoListMap m_whoList;
+    static std::unordered_map<uint32, uint64> m_playerKeys;
+    static ACE_Thread_Mutex m_lock;
 };
 
 #endif
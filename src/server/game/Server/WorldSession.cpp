@@ -28,6 +28,7 @@
 #include "OutdoorPvPMgr.h"
 #include "MapManager.h"
 #include "SocialMgr.h"
+#include "WhoListCache.h"
 #include "zlib.h"
 #include "ScriptMgr.h"
 #include "Transport.h"
@@ -578,6 +579,7 @@ void WorldSession::LogoutPlayer(bool save)
         if (AccountMgr::IsGMAccount(GetSecurity())) // pussywizard: only for non-gms
             sSocialMgr->SendFriendStatus(_player, FRIEND_OFFLINE, _player->GetGUIDLow(), true);
         sSocialMgr->RemovePlayerSocial(_player->GetGUIDLow());
+        WhoListCacheMgr::RemovePlayer(_player);
 
         //! Call script hook before deletion
         sScriptMgr->OnPlayerLogout(_player);
@@ -701,7 +701,10 @@ void AuraEffect::ChangeAmount(int32 newAmount, bool mark, bool onStackOrReapply)
     if (handleMask & AURA_EFFECT_HANDLE_CHANGE_AMOUNT)
     {
         if (!mark)
+        {
             m_amount = newAmount;
+            InvalidateTargetModifierCache();
+        }
         else
             SetAmount(newAmount);
         CalculateSpellMod();
@@ -712,6 +715,14 @@ void AuraEffect::ChangeAmount(int32 newAmount, bool mark, bool onStackOrReapply)
             HandleEffect(*apptItr, handleMask, true);
 }
 
+void AuraEffect::InvalidateTargetModifierCache()
+{
+    // the effect is registered in m_modAuras of every target it is applied to
+    Aura::ApplicationMap const& applications = GetBase()->GetApplicationMap();
+    for (Aura::ApplicationMap::const_iterator itr = applications.begin(); itr != applications.end(); ++itr)
+        itr->second->GetTarget()->InvalidateAuraModifierCache(GetAuraType());
+}
+
 void AuraEffect::HandleEffect(AuraApplication * aurApp, uint8 mode, bool apply)
 {
     // check if call is correct, we really don't want using bitmasks here (with 1 exception)
@@ -891,6 +902,12 @@ void AuraEffect::Update(uint32 diff, Unit* caster)
     }
 }
 
+bool AuraEffect::IsPeriodicTickDue(uint32 diff) const
+{
+    // same conditions as the tick loop in Update
+    return m_isPeriodic && m_periodicTimer <= int32(diff) && (GetBase()->GetDuration() >= 0 || GetBase()->IsPassive() || GetBase()->IsPermanent());
+}
+
 void AuraEffect::UpdatePeriodic(Unit* caster)
 {
     switch (GetAuraType())
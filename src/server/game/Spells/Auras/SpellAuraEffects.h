@@ -45,7 +45,7 @@ class AuraEffect
         AuraType GetAuraType() const { return (AuraType)m_spellInfo->Effects[m_effIndex].ApplyAuraName; }
         int32 GetAmount() const { return m_isAuraEnabled ? m_amount : 0; }
         int32 GetForcedAmount() const { return m_amount; }
-        void SetAmount(int32 amount) { m_amount = amount; m_canBeRecalculated = false;}
+        void SetAmount(int32 amount) { m_amount = amount; m_canBeRecalculated = false; InvalidateTargetModifierCache(); }
 
         int32 GetPeriodicTimer() const { return m_periodicTimer; }
         void SetPeriodicTimer(int32 periodicTimer) { m_periodicTimer = periodicTimer; }
@@ -55,6 +55,7 @@ class AuraEffect
         void CalculatePeriodicData();
         void CalculateSpellMod();
         void ChangeAmount(int32 newAmount, bool mark = true, bool onStackOrReapply = false);
+        void InvalidateTargetModifierCache();
         void RecalculateAmount() { if (!CanBeRecalculated()) return; ChangeAmount(CalculateAmount(GetCaster()), false); }
         void RecalculateAmount(Unit* caster) { if (!CanBeRecalculated()) return; ChangeAmount(CalculateAmount(caster), false); }
         bool CanBeRecalculated() const { return m_canBeRecalculated; }
@@ -65,6 +66,7 @@ class AuraEffect
 
         void Update(uint32 diff, Unit* caster);
         void UpdatePeriodic(Unit* caster);
+        bool IsPeriodicTickDue(uint32 diff) const;
 
         uint32 GetTickNumber() const { return m_tickNumber; }
         int32 GetTotalTicks() const { return m_amplitude ? (GetBase()->GetMaxDuration() / m_amplitude) : 1;}
@@ -96,7 +98,7 @@ class AuraEffect
         uint32 GetAuraGroup() const { return m_auraGroup; }
         int32 GetOldAmount() const { return m_oldAmount; }
         void SetOldAmount(int32 amount) { m_oldAmount = amount; }
-        void SetEnabled(bool enabled) { m_isAuraEnabled = enabled; }
+        void SetEnabled(bool enabled) { m_isAuraEnabled = enabled; InvalidateTargetModifierCache(); }
 
     private:
         Aura* const m_base;
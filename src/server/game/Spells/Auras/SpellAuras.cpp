@@ -718,6 +718,21 @@ void Aura::UpdateOwner(uint32 diff, WorldObject* owner)
         ASSERT(false);
     }
 
+    // most auras have nothing to do in a given tick, advance their timers without
+    // looking up the caster and its spellmods; effects cannot tick here
+    if (!IsUpdateDue(diff))
+    {
+        Update(diff, NULL);
+        m_updateTargetMapInterval -= diff;
+
+        for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+            if (m_effects[i])
+                m_effects[i]->Update(diff, NULL);
+
+        _DeleteRemovedApplications();
+        return;
+    }
+
     Unit* caster = GetCaster();
     // Apply spellmods for channeled auras
     // used for example when triggered spell of spell:10 is modded
@@ -753,6 +768,22 @@ void Aura::UpdateOwner(uint32 diff, WorldObject* owner)
     _DeleteRemovedApplications();
 }
 
+bool Aura::IsUpdateDue(uint32 diff) const
+{
+    // power per second is taken
+    if (m_duration > 0 && m_timeCla && m_timeCla <= int32(diff))
+        return true;
+
+    if (m_updateTargetMapInterval <= int32(diff))
+        return true;
+
+    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+        if (m_effects[i] && m_effects[i]->IsPeriodicTickDue(diff))
+            return true;
+
+    return false;
+}
+
 void Aura::Update(uint32 diff, Unit* caster)
 {
     if (m_duration > 0)
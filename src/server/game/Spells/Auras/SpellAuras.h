@@ -119,6 +119,7 @@ class Aura
 
         void UpdateOwner(uint32 diff, WorldObject* owner);
         void Update(uint32 diff, Unit* caster);
+        bool IsUpdateDue(uint32 diff) const;
 
         time_t GetApplyTime() const { return m_applyTime; }
         int32 GetMaxDuration() const { return m_maxDuration; }
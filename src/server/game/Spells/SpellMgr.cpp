@@ -1991,6 +1991,34 @@ void SpellMgr::LoadSpellThreats()
     sLog->outString();
 }
 
+void SpellMgr::LoadSpellProcEventFlags()
+{
+    uint32 oldMSTime = getMSTime();
+
+    // must be after LoadSpellProcEvents and LoadSpellProcs, mirrors the first checks of Unit::IsTriggeredAtSpellProcEvent
+    mSpellProcEventFlags.assign(GetSpellInfoStoreSize(), 0);
+
+    uint32 count = 0;
+    for (uint32 i = 0; i < GetSpellInfoStoreSize(); ++i)
+    {
+        SpellInfo const* spellInfo = mSpellInfoMap[i];
+        if (!spellInfo)
+            continue;
+
+        // handled by the new proc system
+        if (GetSpellProcEntry(i))
+            continue;
+
+        SpellProcEventEntry const* spellProcEvent = GetSpellProcEvent(i);
+        mSpellProcEventFlags[i] = spellProcEvent && spellProcEvent->procFlags ? spellProcEvent->procFlags : spellInfo->ProcFlags;
+        if (mSpellProcEventFlags[i])
+            ++count;
+    }
+
+    sLog->outString(">> Built proc flags for %u spells in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
+    sLog->outString();
+}
+
 void SpellMgr::LoadSpellMixology()
 {
     uint32 oldMSTime = getMSTime();
@@ -3207,6 +3235,41 @@ void SpellMgr::LoadSpellCustomAttr()
     sLog->outString();
 }
 
+void SpellMgr::LoadSpellHotInfo()
+{
+    uint32 oldMSTime = getMSTime();
+
+    // must be after LoadSpellCustomAttr, which still changes attributes and effects
+    uint32 size = GetSpellInfoStoreSize();
+    mSpellHotInfoMap.assign(size, SpellHotInfo());
+
+    uint32 count = 0;
+    for (uint32 i = 0; i < size; ++i)
+    {
+        SpellInfo const* spellInfo = mSpellInfoMap[i];
+        if (!spellInfo)
+            continue;
+
+        SpellHotInfo& hotInfo = mSpellHotInfoMap[i];
+        hotInfo.SchoolMask = spellInfo->SchoolMask;
+        hotInfo.Mechanic = spellInfo->Mechanic;
+        hotInfo.PowerType = spellInfo->PowerType;
+        hotInfo.ManaCost = spellInfo->ManaCost;
+        hotInfo.PreventionType = spellInfo->PreventionType;
+        for (uint8 j = 0; j < 2; ++j)
+        {
+            hotInfo.MinRange[j] = spellInfo->GetMinRange(j != 0);
+            hotInfo.MaxRange[j] = spellInfo->GetMaxRange(j != 0);
+        }
+        for (uint8 j = 0; j < MAX_SPELL_EFFECTS; ++j)
+            hotInfo.Effect[j] = uint8(spellInfo->Effects[j].Effect);
+        ++count;
+    }
+
+    sLog->outString(">> Built hot info for %u spells in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
+    sLog->outString();
+}
+
 void SpellMgr::LoadDbcDataCorrections()
 {
     uint32 oldMSTime = getMSTime();
@@ -569,6 +569,35 @@ typedef std::vector<bool> EnchantCustomAttribute;
 
 typedef std::vector<SpellInfo*> SpellInfoMap;
 
+// Copy of the SpellInfo fields read when creatures choose a spell, packed into one record per
+// spell id so a scan over a creature's spells touches a single cache line per spell instead of
+// the whole SpellInfo and the DBC entries it points to. Ranges are the unmodified ones of
+// SpellInfo::GetMin/MaxRange. Callers only fetch the SpellInfo of the spell they pick.
+struct SpellHotInfo
+{
+    uint32 SchoolMask;
+    uint32 Mechanic;
+    uint32 PowerType;
+    uint32 ManaCost;
+    uint32 PreventionType;
+    float  MinRange[2];                                     // hostile, friendly
+    float  MaxRange[2];                                     // hostile, friendly
+    uint8  Effect[MAX_SPELL_EFFECTS];
+
+    bool HasEffect(SpellEffects effect) const
+    {
+        for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+            if (Effect[i] == effect)
+                return true;
+        return false;
+    }
+
+    float GetMinRange(bool positive) const { return MinRange[positive ? 1 : 0]; }
+    float GetMaxRange(bool positive) const { return MaxRange[positive ? 1 : 0]; }
+};
+
+typedef std::vector<SpellHotInfo> SpellHotInfoMap;
+
 typedef std::map<int32, std::vector<int32> > SpellLinkedMap;
 
 bool IsPrimaryProfessionSkill(uint32 skill);
@@ -647,6 +676,9 @@ class SpellMgr
         SpellProcEventEntry const* GetSpellProcEvent(uint32 spellId) const;
         bool IsSpellProcEventCanTriggeredBy(SpellInfo const* spellProto, SpellProcEventEntry const* spellProcEvent, uint32 EventProcFlag, SpellInfo const* procSpell, uint32 procFlags, uint32 procExtra, bool active) const;
 
+        // Proc flags an aura of the spell reacts to in the old proc system, 0 if it can never proc there
+        uint32 GetSpellProcEventFlags(uint32 spellId) const { return spellId < mSpellProcEventFlags.size() ? mSpellProcEventFlags[spellId] : 0; }
+
         // Spell proc table
         SpellProcEntry const* GetSpellProcEntry(uint32 spellId) const;
         bool CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo) const;
@@ -682,6 +714,7 @@ class SpellMgr
         // SpellInfo object management
         SpellInfo const* GetSpellInfo(uint32 spellId) const { return spellId < GetSpellInfoStoreSize() ?  mSpellInfoMap[spellId] : NULL; }
         uint32 GetSpellInfoStoreSize() const { return mSpellInfoMap.size(); }
+        SpellHotInfo const* GetSpellHotInfo(uint32 spellId) const { return spellId < mSpellHotInfoMap.size() && mSpellInfoMap[spellId] ? &mSpellHotInfoMap[spellId] : NULL; }
 
         // Talent Additional Set
         bool IsAdditionalTalentSpell(uint32 spellId) const;
@@ -700,6 +733,7 @@ class SpellMgr
         void LoadSpellGroupStackRules();
         void LoadSpellProcEvents();
         void LoadSpellProcs();
+        void LoadSpellProcEventFlags();
         void LoadSpellBonusess();
         void LoadSpellThreats();
         void LoadSpellMixology();
@@ -715,6 +749,7 @@ class SpellMgr
         void UnloadSpellInfoStore();
         void UnloadSpellInfoImplicitTargetConditionLists();
         void LoadSpellCustomAttr();
+        void LoadSpellHotInfo();
         void LoadDbcDataCorrections();
         void LoadSpellSpecificAndAuraState();
 
@@ -729,6 +764,7 @@ class SpellMgr
         SpellGroupStackMap         mSpellGroupStackMap;
         SpellProcEventMap          mSpellProcEventMap;
         SpellProcMap               mSpellProcMap;
+        std::vector<uint32>        mSpellProcEventFlags;
         SpellBonusMap              mSpellBonusMap;
         SpellThreatMap             mSpellThreatMap;
         SpellMixologyMap           mSpellMixologyMap;
@@ -745,6 +781,7 @@ class SpellMgr
         PetLevelupSpellMap         mPetLevelupSpellMap;
         PetDefaultSpellsMap        mPetDefaultSpellsMap;           // only spells not listed in related mPetLevelupSpellMap entry
         SpellInfoMap               mSpellInfoMap;
+        SpellHotInfoMap            mSpellHotInfoMap;
         TalentAdditionalSet        mTalentSpellAdditionalSet;
 };
 
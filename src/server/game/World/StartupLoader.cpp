@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2016+     AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE-GPL2
+ */
+
+#include "StartupLoader.h"
+#include "DatabaseEnv.h"
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+void StartupLoader::AddTask(char const* name, LoadFunction function, std::vector<std::string> const& after)
+{
+    uint32 index = _tasks.size();
+
+    Task task;
+    task.Name = name;
+    task.Function = function;
+    task.Dependencies = 0;
+
+    for (std::vector<std::string>::const_iterator itr = after.begin(); itr != after.end(); ++itr)
+    {
+        bool found = false;
+        for (uint32 i = 0; i < index; ++i)
+        {
+            if (_tasks[i].Name != *itr)
+                continue;
+
+            _tasks[i].Dependents.push_back(index);
+            ++task.Dependencies;
+            found = true;
+            break;
+        }
+
+        // dependencies must be registered first, this also rules out cycles
+        ASSERT(found);
+    }
+
+    _tasks.push_back(task);
+}
+
+void StartupLoader::Run(uint32 threads)
+{
+    uint32 oldMSTime = getMSTime();
+
+    if (threads > _tasks.size())
+        threads = _tasks.size();
+
+    if (threads <= 1)
+    {
+        // declaration order is always a valid topological order
+        for (std::vector<Task>::const_iterator itr = _tasks.begin(); itr != _tasks.end(); ++itr)
+            itr->Function();
+    }
+    else
+    {
+        std::mutex lock;
+        std::condition_variable condition;
+        std::deque<uint32> ready;
+        std::vector<uint32> pending(_tasks.size());
+        uint32 remaining = _tasks.size();
+
+        for (uint32 i = 0; i < _tasks.size(); ++i)
+        {
+            pending[i] = _tasks[i].Dependencies;
+            if (!pending[i])
+                ready.push_back(i);
+        }
+
+        auto worker = [&]()
+        {
+            MySQL::Thread_Init();
+
+            std::unique_lock<std::mutex> guard(lock);
+            for (;;)
+            {
+                condition.wait(guard, [&]() { return !ready.empty() || !remaining; });
+                if (ready.empty())
+                    break;
+
+                uint32 index = ready.front();
+                ready.pop_front();
+
+                guard.unlock();
+                _tasks[index].Function();
+                guard.lock();
+
+                --remaining;
+                for (std::vector<uint32>::const_iterator itr = _tasks[index].Dependents.begin(); itr != _tasks[index].Dependents.end(); ++itr)
+                    if (!--pending[*itr])
+                        ready.push_back(*itr);
+
+                condition.notify_all();
+            }
+            guard.unlock();
+
+            MySQL::Thread_End();
+        };
+
+        std::vector<std::thread> workers;
+        for (uint32 i = 0; i < threads; ++i)
+            workers.push_back(std::thread(worker));
+
+        for (std::vector<std::thread>::iterator itr = workers.begin(); itr != workers.end(); ++itr)
+            itr->join();
+    }
+
+    sLog->outString(">> %s: %u loaders finished using %u thread(s) in %u ms", _name.c_str(), uint32(_tasks.size()), std::max<uint32>(threads, 1), GetMSTimeDiffToNow(oldMSTime));
+    sLog->outString();
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2016+     AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license: https://github.com/azerothcore/azerothcore-wotlk/blob/master/LICENSE-GPL2
+ */
+
+#ifndef _STARTUPLOADER_H
+#define _STARTUPLOADER_H
+
+#include "Define.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+/// Runs a group of startup loaders whose ordering is declared as explicit dependency edges.
+/// A task can only depend on tasks added before it, so the graph is acyclic by construction.
+/// With one thread all tasks run in declaration order on the calling thread.
+class StartupLoader
+{
+    public:
+        typedef std::function<void()> LoadFunction;
+
+        explicit StartupLoader(char const* name) : _name(name) { }
+
+        /// Registers a loader; `after` names previously added tasks that must finish first.
+        void AddTask(char const* name, LoadFunction function, std::vector<std::string> const& after = std::vector<std::string>());
+
+        /// Executes all tasks, using up to `threads` workers with their own MySQL thread context.
+        void Run(uint32 threads);
+
+    private:
+        struct Task
+        {
+            std::string Name;
+            LoadFunction Function;
+            std::vector<uint32> Dependents;
+            uint32 Dependencies;
+        };
+
+        std::string _name;
+        std::vector<Task> _tasks;
+};
+
+#endif
@@ -72,11 +72,11 @@
 #include "TransportMgr.h"
 #include "AvgDiffTracker.h"
 #include "DynamicVisibility.h"
-#include "WhoListCache.h"
 #include "AsyncAuctionListing.h"
 #include "SavingSystem.h"
 #include "ServerMotd.h"
 #include "GameGraveyard.h"
+#include "StartupLoader.h"
 #include <VMapManager2.h>
 #ifdef ELUNA
 #include "LuaEngine.h"
@@ -656,6 +656,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_TRADE_LEVEL_REQ] = sConfigMgr->GetIntDefault("LevelReq.Trade", 1);
     m_int_configs[CONFIG_TICKET_LEVEL_REQ] = sConfigMgr->GetIntDefault("LevelReq.Ticket", 1);
     m_int_configs[CONFIG_AUCTION_LEVEL_REQ] = sConfigMgr->GetIntDefault("LevelReq.Auction", 1);
+    m_int_configs[CONFIG_AUCTION_EXPIRE_PER_UPDATE] = sConfigMgr->GetIntDefault("AuctionHouse.ExpirePerUpdate", 1000);
     m_int_configs[CONFIG_MAIL_LEVEL_REQ] = sConfigMgr->GetIntDefault("LevelReq.Mail", 1);
     m_bool_configs[CONFIG_ALLOW_PLAYER_COMMANDS] = sConfigMgr->GetBoolDefault("AllowPlayerCommands", 1);
     m_bool_configs[CONFIG_PRESERVE_CUSTOM_CHANNELS] = sConfigMgr->GetBoolDefault("PreserveCustomChannels", false);
@@ -947,6 +948,8 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_GROUP_VISIBILITY] = sConfigMgr->GetIntDefault("Visibility.GroupMode", 1);
 
     m_int_configs[CONFIG_MAIL_DELIVERY_DELAY] = sConfigMgr->GetIntDefault("MailDeliveryDelay", HOUR);
+    m_int_configs[CONFIG_MAIL_EXPIRE_PAGE_SIZE] = sConfigMgr->GetIntDefault("Mail.ExpirePageSize", 1000);
+    m_int_configs[CONFIG_MAIL_EXPIRE_UPDATE_TIME] = sConfigMgr->GetIntDefault("Mail.ExpireUpdateTime", 5);
 
     m_int_configs[CONFIG_UPTIME_UPDATE] = sConfigMgr->GetIntDefault("UpdateUptimeInterval", 10);
     if (int32(m_int_configs[CONFIG_UPTIME_UPDATE]) <= 0)
@@ -1037,6 +1040,7 @@ void World::LoadConfigSettings(bool reload)
     m_float_configs[CONFIG_CREATURE_FAMILY_ASSISTANCE_RADIUS] = sConfigMgr->GetFloatDefault("CreatureFamilyAssistanceRadius", 10.0f);
     m_int_configs[CONFIG_CREATURE_FAMILY_ASSISTANCE_DELAY]  = sConfigMgr->GetIntDefault("CreatureFamilyAssistanceDelay", 1500);
     m_int_configs[CONFIG_CREATURE_FAMILY_FLEE_DELAY]        = sConfigMgr->GetIntDefault("CreatureFamilyFleeDelay", 7000);
+    m_int_configs[CONFIG_CREATURE_IDLE_UPDATE_INTERVAL]     = sConfigMgr->GetIntDefault("Creature.IdleUpdateInterval", 0);
 
     m_int_configs[CONFIG_WORLD_BOSS_LEVEL_DIFF] = sConfigMgr->GetIntDefault("WorldBossLevelDiff", 3);
 
@@ -1248,6 +1252,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] = sConfigMgr->GetIntDefault("RecordUpdateTimeDiffInterval", 60000);
     m_int_configs[CONFIG_MIN_LOG_UPDATE] = sConfigMgr->GetIntDefault("MinRecordUpdateTimeDiff", 100);
     m_int_configs[CONFIG_NUMTHREADS] = sConfigMgr->GetIntDefault("MapUpdate.Threads", 1);
+    m_int_configs[CONFIG_STARTUP_LOADER_THREADS] = sConfigMgr->GetIntDefault("Startup.LoaderThreads", 1);
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetIntDefault("Command.LookupMaxResults", 0);
 
     // chat logging
@@ -1336,6 +1341,7 @@ void World::LoadConfigSettings(bool reload)
 
     m_bool_configs[CONFIG_CALCULATE_CREATURE_ZONE_AREA_DATA] = sConfigMgr->GetBoolDefault("Calculate.Creature.Zone.Area.Data", false);
     m_bool_configs[CONFIG_CALCULATE_GAMEOBJECT_ZONE_AREA_DATA] = sConfigMgr->GetBoolDefault("Calculate.Gameoject.Zone.Area.Data", false);
+    m_bool_configs[CONFIG_WORLD_DATA_SNAPSHOT] = sConfigMgr->GetBoolDefault("WorldDataSnapshot.Enable", false);
 
     // Player can join LFG anywhere
     m_bool_configs[CONFIG_LFG_LOCATION_ALL] = sConfigMgr->GetBoolDefault("LFG.Location.All", false);
@@ -1453,6 +1459,9 @@ void World::SetInitialWorldSettings()
     sLog->outString("Loading spell custom attributes...");
     sSpellMgr->LoadSpellCustomAttr();
 
+    sLog->outString("Building spell hot data...");
+    sSpellMgr->LoadSpellHotInfo();
+
     sLog->outString("Loading GameObject models...");
     LoadGameObjectModelList();
 
@@ -1470,27 +1479,24 @@ void World::SetInitialWorldSettings()
     sLog->outString("Loading instances...");
     sInstanceSaveMgr->LoadInstances();
 
-    sLog->outString("Loading Broadcast texts...");
-    sObjectMgr->LoadBroadcastTexts();
-    sObjectMgr->LoadBroadcastTextLocales();
-
-    sLog->outString("Loading Localization strings...");
-    uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadItemSetNameLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadQuestOfferRewardLocale();
-    sObjectMgr->LoadQuestRequestItemsLocale();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
+    sLog->outString("Loading Broadcast texts and Localization strings...");
+    StartupLoader localeLoader("Localization strings");
+    localeLoader.AddTask("BroadcastTexts", [] { sObjectMgr->LoadBroadcastTexts(); });
+    localeLoader.AddTask("BroadcastTextLocales", [] { sObjectMgr->LoadBroadcastTextLocales(); }, { "BroadcastTexts" });
+    localeLoader.AddTask("CreatureLocales", [] { sObjectMgr->LoadCreatureLocales(); });
+    localeLoader.AddTask("GameObjectLocales", [] { sObjectMgr->LoadGameObjectLocales(); });
+    localeLoader.AddTask("ItemLocales", [] { sObjectMgr->LoadItemLocales(); });
+    localeLoader.AddTask("ItemSetNameLocales", [] { sObjectMgr->LoadItemSetNameLocales(); });
+    localeLoader.AddTask("QuestLocales", [] { sObjectMgr->LoadQuestLocales(); });
+    localeLoader.AddTask("QuestOfferRewardLocale", [] { sObjectMgr->LoadQuestOfferRewardLocale(); });
+    localeLoader.AddTask("QuestRequestItemsLocale", [] { sObjectMgr->LoadQuestRequestItemsLocale(); });
+    localeLoader.AddTask("NpcTextLocales", [] { sObjectMgr->LoadNpcTextLocales(); });
+    localeLoader.AddTask("PageTextLocales", [] { sObjectMgr->LoadPageTextLocales(); });
+    localeLoader.AddTask("GossipMenuItemsLocales", [] { sObjectMgr->LoadGossipMenuItemsLocales(); });
+    localeLoader.AddTask("PointOfInterestLocales", [] { sObjectMgr->LoadPointOfInterestLocales(); });
+    localeLoader.Run(getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    sLog->outString(">> Localization strings loaded in %u ms", GetMSTimeDiffToNow(oldMSTime));
-    sLog->outString();
 
     sLog->outString("Loading Page Texts...");
     sObjectMgr->LoadPageTexts();
@@ -1504,77 +1510,40 @@ void World::SetInitialWorldSettings()
     sLog->outString("Loading Transport templates...");
     sTransportMgr->LoadTransportTemplates();
 
-    sLog->outString("Loading Spell Required Data...");
-    sSpellMgr->LoadSpellRequired();
-
-    sLog->outString("Loading Spell Group types...");
-    sSpellMgr->LoadSpellGroups();
-
-    sLog->outString("Loading Spell Learn Skills...");
-    sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
-
-    sLog->outString("Loading Spell Proc Event conditions...");
-    sSpellMgr->LoadSpellProcEvents();
-
-    sLog->outString("Loading Spell Proc conditions and data...");
-    sSpellMgr->LoadSpellProcs();
-
-    sLog->outString("Loading Spell Bonus Data...");
-    sSpellMgr->LoadSpellBonusess();
-
-    sLog->outString("Loading Aggro Spells Definitions...");
-    sSpellMgr->LoadSpellThreats();
-
-    sLog->outString("Loading Mixology bonuses...");
-    sSpellMgr->LoadSpellMixology();
-
-    sLog->outString("Loading Spell Group Stack Rules...");
-    sSpellMgr->LoadSpellGroupStackRules();
-
-    sLog->outString("Loading NPC Texts...");
-    sObjectMgr->LoadGossipText();
-
-    sLog->outString("Loading Enchant Spells Proc datas...");
-    sSpellMgr->LoadSpellEnchantProcData();
-
-    sLog->outString("Loading Item Random Enchantments Table...");
-    LoadRandomEnchantmentsTable();
-
-    sLog->outString("Loading Disables");
-    DisableMgr::LoadDisables();                                  // must be before loading quests and items
-
-    sLog->outString("Loading Items...");                         // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr->LoadItemTemplates();
-
-    sLog->outString("Loading Item set names...");                // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemSetNames();
-
-    sLog->outString("Loading Creature Model Based Info Data...");
-    sObjectMgr->LoadCreatureModelInfo();
-
-    sLog->outString("Loading Creature templates...");
-    sObjectMgr->LoadCreatureTemplates();
-
-    sLog->outString("Loading Equipment templates...");           // must be after LoadCreatureTemplates
-    sObjectMgr->LoadEquipmentTemplates();
-
-    sLog->outString("Loading Creature template addons...");
-    sObjectMgr->LoadCreatureTemplateAddons();
-
-    sLog->outString("Loading Reputation Reward Rates...");
-    sObjectMgr->LoadReputationRewardRate();
-
-    sLog->outString("Loading Creature Reputation OnKill Data...");
-    sObjectMgr->LoadReputationOnKill();
-
-    sLog->outString("Loading Reputation Spillover Data..." );
-    sObjectMgr->LoadReputationSpilloverTemplate();
-
-    sLog->outString("Loading Points Of Interest Data...");
-    sObjectMgr->LoadPointsOfInterest();
-
-    sLog->outString("Loading Creature Base Stats...");
-    sObjectMgr->LoadCreatureClassLevelStats();
+    // the spell data tables below only read the SpellInfo store and rank chains and each fill their own container
+    sLog->outString("Loading Spell Data tables...");
+    StartupLoader spellLoader("Spell Data tables");
+    spellLoader.AddTask("SpellRequired", [] { sSpellMgr->LoadSpellRequired(); });
+    spellLoader.AddTask("SpellGroups", [] { sSpellMgr->LoadSpellGroups(); });
+    spellLoader.AddTask("SpellLearnSkills", [] { sSpellMgr->LoadSpellLearnSkills(); });     // must be after LoadSpellRanks
+    spellLoader.AddTask("SpellProcEvents", [] { sSpellMgr->LoadSpellProcEvents(); });
+    spellLoader.AddTask("SpellProcs", [] { sSpellMgr->LoadSpellProcs(); });
+    spellLoader.AddTask("SpellProcEventFlags", [] { sSpellMgr->LoadSpellProcEventFlags(); }, { "SpellProcEvents", "SpellProcs" });
+    spellLoader.AddTask("SpellBonuses", [] { sSpellMgr->LoadSpellBonusess(); });
+    spellLoader.AddTask("SpellThreats", [] { sSpellMgr->LoadSpellThreats(); });
+    spellLoader.AddTask("SpellMixology", [] { sSpellMgr->LoadSpellMixology(); });
+    spellLoader.AddTask("SpellGroupStackRules", [] { sSpellMgr->LoadSpellGroupStackRules(); }, { "SpellGroups" });
+    spellLoader.AddTask("SpellEnchantProcData", [] { sSpellMgr->LoadSpellEnchantProcData(); });
+    spellLoader.Run(getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
+
+    // item and creature templates and the tables only checked against them, each loader fills its own container
+    sLog->outString("Loading Item and Creature templates...");
+    StartupLoader templateLoader("Item and Creature templates");
+    templateLoader.AddTask("GossipText", [] { sObjectMgr->LoadGossipText(); });
+    templateLoader.AddTask("RandomEnchantments", [] { LoadRandomEnchantmentsTable(); });
+    templateLoader.AddTask("Disables", [] { DisableMgr::LoadDisables(); });
+    templateLoader.AddTask("ItemTemplates", [] { sObjectMgr->LoadItemTemplates(); }, { "RandomEnchantments", "Disables" });
+    templateLoader.AddTask("ItemSetNames", [] { sObjectMgr->LoadItemSetNames(); }, { "ItemTemplates" });
+    templateLoader.AddTask("CreatureModelInfo", [] { sObjectMgr->LoadCreatureModelInfo(); });
+    templateLoader.AddTask("CreatureTemplates", [] { sObjectMgr->LoadCreatureTemplates(); }, { "CreatureModelInfo" });
+    templateLoader.AddTask("EquipmentTemplates", [] { sObjectMgr->LoadEquipmentTemplates(); }, { "CreatureTemplates", "ItemTemplates" });
+    templateLoader.AddTask("CreatureTemplateAddons", [] { sObjectMgr->LoadCreatureTemplateAddons(); }, { "CreatureTemplates" });
+    templateLoader.AddTask("ReputationRewardRate", [] { sObjectMgr->LoadReputationRewardRate(); });
+    templateLoader.AddTask("ReputationOnKill", [] { sObjectMgr->LoadReputationOnKill(); }, { "CreatureTemplates" });
+    templateLoader.AddTask("ReputationSpillover", [] { sObjectMgr->LoadReputationSpilloverTemplate(); });
+    templateLoader.AddTask("PointsOfInterest", [] { sObjectMgr->LoadPointsOfInterest(); });
+    templateLoader.AddTask("CreatureClassLevelStats", [] { sObjectMgr->LoadCreatureClassLevelStats(); }, { "CreatureTemplates" });
+    templateLoader.Run(getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
 
     sLog->outString("Loading Creature Data...");
     sObjectMgr->LoadCreatures();
@@ -1705,8 +1674,23 @@ void World::SetInitialWorldSettings()
     sLog->outString("Loading Player level dependent mail rewards...");
     sObjectMgr->LoadMailLevelRewards();
 
-    // Loot tables
-    LoadLootTables();
+    // Loot tables, the reference loot is checked against all other stores
+    sLog->outString("Loading Loot Tables...");
+    StartupLoader lootLoader("Loot Tables");
+    lootLoader.AddTask("CreatureLoot", [] { LoadLootTemplates_Creature(); });
+    lootLoader.AddTask("FishingLoot", [] { LoadLootTemplates_Fishing(); });
+    lootLoader.AddTask("GameobjectLoot", [] { LoadLootTemplates_Gameobject(); });
+    lootLoader.AddTask("ItemLoot", [] { LoadLootTemplates_Item(); });
+    lootLoader.AddTask("MailLoot", [] { LoadLootTemplates_Mail(); });
+    lootLoader.AddTask("MillingLoot", [] { LoadLootTemplates_Milling(); });
+    lootLoader.AddTask("PickpocketingLoot", [] { LoadLootTemplates_Pickpocketing(); });
+    lootLoader.AddTask("SkinningLoot", [] { LoadLootTemplates_Skinning(); });
+    lootLoader.AddTask("DisenchantLoot", [] { LoadLootTemplates_Disenchant(); });
+    lootLoader.AddTask("ProspectingLoot", [] { LoadLootTemplates_Prospecting(); });
+    lootLoader.AddTask("SpellLoot", [] { LoadLootTemplates_Spell(); });
+    lootLoader.AddTask("ReferenceLoot", [] { LoadLootTemplates_Reference(); }, { "CreatureLoot", "FishingLoot", "GameobjectLoot", "ItemLoot", "MailLoot",
+        "MillingLoot", "PickpocketingLoot", "SkinningLoot", "DisenchantLoot", "ProspectingLoot", "SpellLoot" });
+    lootLoader.Run(getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
 
     sLog->outString("Loading Skill Discovery Table...");
     LoadSkillDiscoveryTable();
@@ -2102,9 +2086,6 @@ void World::Update(uint32 diff)
         // moved here from HandleCharEnumOpcode
         PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_BANS);
         CharacterDatabase.Execute(stmt);
-
-        // copy players hashmapholder to avoid mutex
-        WhoListCacheMgr::Update();
     }
 
     ///- Update the game time and check for shutdown time
@@ -2141,7 +2122,9 @@ void World::Update(uint32 diff)
             m_timers[WUPDATE_AUCTIONS].Reset();
 
             // pussywizard: handle expired auctions, auctions expired when realm was offline are also handled here (not during loading when many required things aren't loaded yet)
-            sAuctionMgr->Update();
+            // continue on the next tick if not all due auctions fit into this one
+            if (!sAuctionMgr->Update())
+                m_timers[WUPDATE_AUCTIONS].SetCurrent(m_timers[WUPDATE_AUCTIONS].GetInterval());
         }
 
         AsyncAuctionListingMgr::Update(diff);
@@ -2152,6 +2135,8 @@ void World::Update(uint32 diff)
             mail_expire_check_timer = m_gameTime + 6*3600;
         }
 
+        sObjectMgr->UpdateOldMails();
+
         UpdateSessions(diff);
     } 
     // end of section with mutex
@@ -17,6 +17,7 @@ EndScriptData */
 #include "GuildMgr.h"
 #include "ObjectAccessor.h"
 #include "ScriptMgr.h"
+#include "WhoListCache.h"
 
 class guild_commandscript : public CommandScript
 {
@@ -85,6 +86,8 @@ public:
         }
 
         sGuildMgr->AddGuild(guild);
+        // the guild name could not be resolved while the guild master was added in Create
+        WhoListCacheMgr::UpdatePlayer(target);
 
         return true;
     }
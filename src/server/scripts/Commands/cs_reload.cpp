@@ -877,6 +877,7 @@ public:
     {
         sLog->outString("Re-Loading Spell Proc Event conditions...");
         sSpellMgr->LoadSpellProcEvents();
+        sSpellMgr->LoadSpellProcEventFlags();
         handler->SendGlobalGMSysMessage("DB table `spell_proc_event` (spell proc trigger requirements) reloaded.");
         return true;
     }
@@ -885,6 +886,7 @@ public:
     {
         sLog->outString("Re-Loading Spell Proc conditions and data...");
         sSpellMgr->LoadSpellProcs();
+        sSpellMgr->LoadSpellProcEventFlags();
         handler->SendGlobalGMSysMessage("DB table `spell_proc` (spell proc conditions and data) reloaded.");
         return true;
     }
@@ -265,8 +265,8 @@ class spell_mother_shahraz_fatal_attraction : public SpellScriptLoader
 
             void SetDest(SpellDestination& dest)
             {
-                std::list<Spell::TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-                for (std::list<Spell::TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+                std::vector<Spell::TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+                for (std::vector<Spell::TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
                     if (Unit* target = ObjectAccessor::GetUnit(*GetCaster(), ihit->targetGUID))
                     {
                         dest.Relocate(*target);
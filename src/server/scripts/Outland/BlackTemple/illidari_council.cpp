@@ -614,8 +614,8 @@ class spell_illidari_council_empyreal_balance : public SpellScriptLoader
                 }
 
                 float pct = (_sharedHealth / _sharedHealthMax) * 100.0f;
-                std::list<Spell::TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-                for (std::list<Spell::TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+                std::vector<Spell::TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+                for (std::vector<Spell::TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
                     if (Creature* target = ObjectAccessor::GetCreature(*GetCaster(), ihit->targetGUID))
                     {
                         target->LowerPlayerDamageReq(target->GetMaxHealth());
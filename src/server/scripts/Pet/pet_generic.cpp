@@ -601,8 +601,8 @@ class spell_pet_gen_valkyr_guardian_smite : public SpellScriptLoader
             {
                 if (GetHitUnit() != GetCaster())
                 {
-                    std::list<Spell::TargetInfo>* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-                    for (std::list<Spell::TargetInfo>::iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+                    std::vector<Spell::TargetInfo>* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+                    for (std::vector<Spell::TargetInfo>::iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
                         if (ihit->targetGUID == GetCaster()->GetGUID())
                             ihit->damage = -int32(GetHitDamage()*0.25f);
                 }
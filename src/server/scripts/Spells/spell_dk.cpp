@@ -430,8 +430,8 @@ class spell_dk_chains_of_ice : public SpellScriptLoader
             {
                 if (Unit* target = GetExplTargetUnit())
                 {
-                    std::list<Spell::TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-                    for (std::list<Spell::TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+                    std::vector<Spell::TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+                    for (std::vector<Spell::TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
                         if (ihit->missCondition == SPELL_MISS_NONE && ihit->targetGUID == target->GetGUID())
                             GetCaster()->CastSpell(target, 55095 /*SPELL_FROST_FEVER*/, true);
                 }
@@ -610,8 +610,8 @@ class spell_dk_rune_of_the_fallen_crusader : public SpellScriptLoader
 
             void RecalculateDamage()
             {
-                std::list<Spell::TargetInfo>* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-                for (std::list<Spell::TargetInfo>::iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+                std::vector<Spell::TargetInfo>* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+                for (std::vector<Spell::TargetInfo>::iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
                     if (ihit->targetGUID == GetCaster()->GetGUID())
                         ihit->crit = roll_chance_f(GetCaster()->GetFloatValue(PLAYER_CRIT_PERCENTAGE));
             }
@@ -413,6 +413,12 @@ bool Master::_StartDB()
     }
 
     synch_threads = uint8(sConfigMgr->GetIntDefault("WorldDatabase.SynchThreads", 1));
+
+    // parallel startup loaders need one synchronous connection per worker
+    uint32 loaderThreads = uint32(sConfigMgr->GetIntDefault("Startup.LoaderThreads", 1));
+    if (loaderThreads > synch_threads)
+        synch_threads = uint8(std::min<uint32>(loaderThreads, 32));
+
     ///- Initialise the world database
     if (!WorldDatabase.Open(dbstring, async_threads, synch_threads))
     {